@@ -39,7 +39,9 @@ public:
    *             This name will appear in per-handler/worker statistics, such as
    *             "server.worker_2.watchdog_miss".
    * @param scaled_timer_factory the factory to use when creating the scaled timer manager.
-   * @return Event::DispatcherPtr which is owned by the caller.
+   * @return Event::DispatcherPtr which is owned by the caller. This is used for the dispatchers of
+   *         the worker threads, which keep their timers in the bootstrap's worker_timer_wheel, if
+   *         configured.
    */
   virtual Event::DispatcherPtr
   allocateDispatcher(const std::string& name,
@@ -25,6 +25,21 @@ public:
    * @see sched_getaffinity (man 2 sched_getaffinity)
    */
   virtual SysCallIntResult sched_getaffinity(pid_t pid, size_t cpusetsize, cpu_set_t* mask) PURE;
+
+  /**
+   * @see man 2 pipe2
+   */
+  virtual SysCallIntResult pipe2(int pipefd[2], int flags) PURE;
+
+  /**
+   * @see man 2 splice. Both file descriptors are read and written at their current offset.
+   */
+  virtual SysCallSizeResult splice(int fd_in, int fd_out, size_t length, unsigned int flags) PURE;
+
+  /**
+   * @see man 2 fcntl, for the commands which take an integer argument.
+   */
+  virtual SysCallIntResult fcntl(int fd, int cmd, int arg) PURE;
 };
 
 using LinuxOsSysCallsPtr = std::unique_ptr<LinuxOsSysCalls>;
@@ -331,6 +331,17 @@ public:
    */
   virtual void addViaMove(HeaderString&& key, HeaderString&& value) PURE;
 
+  /**
+   * Add a header by copying its key and value into storage owned by the map. Unlike addViaMove(),
+   * the map may defer creating the entry of a header that is not an O(1) inline header until the
+   * map is first read or modified through a path other than the O(1) inline accessors. This is
+   * used by codecs for decoded headers, most of which are proxied without ever being inspected.
+   * Deferred headers are iterated after the headers that were added eagerly.
+   * @param key supplies the header key. It MUST already be lower case.
+   * @param value supplies the header value.
+   */
+  virtual void addCopyDeferred(absl::string_view key, absl::string_view value) PURE;
+
   /**
    * Add a reference header to the map. Both key and value MUST point to data that will live beyond
    * the lifetime of any request/response using the string (since a codec may optimize for zero
@@ -515,6 +526,26 @@ public:
    */
   virtual void iterateReverse(ConstIterateCb cb) const PURE;
 
+  /**
+   * Callback when iterating the keys and values of a header map for encoding.
+   * @param key supplies the header key.
+   * @param value supplies the header value.
+   * @return Iterate::Continue to continue iteration, or Iterate::Break to stop;
+   */
+  using ConstKeyValueIterateCb = std::function<Iterate(const HeaderString&, const HeaderString&)>;
+
+  /**
+   * Iterate over the keys and values of a constant header map in the same order as iterate(),
+   * without materializing headers added with addCopyDeferred(). This is the path used by codecs
+   * to encode headers, so that decoded headers that were never inspected are encoded straight
+   * from the storage they were decoded into. The HeaderString objects passed to the callback may
+   * be temporaries. Headers which were not materialized are passed as non-reference strings, so
+   * callers which keep references to reference strings only ever reference static storage.
+   * @param cb supplies the iteration callback.
+   * @return whether any header was passed to the callback without having been materialized.
+   */
+  virtual bool iterateForEncoding(ConstKeyValueIterateCb cb) const PURE;
+
   /**
    * Clears the headers in the map.
    */
@@ -85,6 +85,11 @@ public:
    */
   virtual bool flushOnAdmin() const PURE;
 
+  /**
+   * @return bool indicator to flush only the metrics that changed since the previous flush.
+   */
+  virtual bool flushChangedOnly() const PURE;
+
   /**
    * @return true if deferred creation of stats is enabled.
    */
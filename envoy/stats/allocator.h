@@ -99,6 +99,14 @@ public:
    */
   virtual void setSinkPredicates(std::unique_ptr<SinkPredicates>&& sink_predicates) PURE;
 
+  /**
+   * Selects counters to be created with per-thread shards, to reduce cache-line
+   * contention when they are incremented from many threads. Counters that were
+   * created before this call are not affected.
+   * @param tag_extracted_names the tag-extracted names of the counters to shard.
+   */
+  virtual void setShardedCounters(const std::vector<std::string>& tag_extracted_names) PURE;
+
   // TODO(jmarantz): create a parallel mechanism to instantiate histograms. At
   // the moment, histograms don't fit the same pattern of counters and gauges
   // as they are not actually created in the context of a stats allocator.
@@ -9,6 +9,7 @@
 #include "envoy/stats/tag.h"
 
 #include "absl/types/optional.h"
+#include "absl/types/span.h"
 
 namespace Envoy {
 namespace Stats {
@@ -276,6 +277,23 @@ public:
    */
   virtual Store& store() PURE;
   virtual const Store& constStore() const PURE;
+
+  /**
+   * Creates or looks up several counters from their stat names at once. Tag extraction will be
+   * performed on the names. Implementations with a thread local cache resolve all the cache misses
+   * under a single acquisition of the store's lock, which makes this cheaper than calling
+   * counterFromStatName() for each name when the counters are looked up together, e.g. the
+   * response code counters charged for each request.
+   * @param names The names of the stats, obtained from the SymbolTable.
+   * @param counters Receives the counters within the scope's namespace, in the order of names. It
+   *        must have the same size as names.
+   */
+  virtual void countersFromStatNames(absl::Span<const StatName> names,
+                                     absl::Span<Counter*> counters) {
+    for (size_t i = 0; i < names.size(); ++i) {
+      counters[i] = &counterFromStatName(names[i]);
+    }
+  }
 };
 
 } // namespace Stats
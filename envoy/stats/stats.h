@@ -107,12 +107,14 @@ public:
    * Flags:
    * Used: used by all stats types to figure out whether they have been used.
    * Logic...: used by gauges to cache how they should be combined with a parent's value.
+   * Changed: used by gauges and text readouts to track writes since the last latchChanged().
    */
   struct Flags {
     static constexpr uint8_t Used = 0x01;
     static constexpr uint8_t LogicAccumulate = 0x02;
     static constexpr uint8_t NeverImport = 0x04;
     static constexpr uint8_t Hidden = 0x08;
+    static constexpr uint8_t Changed = 0x10;
   };
   virtual SymbolTable& symbolTable() PURE;
   virtual const SymbolTable& constSymbolTable() const PURE;
@@ -191,6 +193,13 @@ public:
    * @param import_mode the new import mode.
    */
   virtual void mergeImportMode(ImportMode import_mode) PURE;
+
+  /**
+   * Reports whether the gauge has been written since the previous call, and clears that state.
+   * This allows stats flushes to skip gauges that have not changed.
+   * @return true if the gauge was written since the previous call to latchChanged().
+   */
+  virtual bool latchChanged() PURE;
 };
 
 using GaugeSharedPtr = RefcountPtr<Gauge>;
@@ -218,6 +227,13 @@ public:
    * @return the copy of this TextReadout value.
    */
   virtual std::string value() const PURE;
+
+  /**
+   * Reports whether the text readout has been set since the previous call, and clears that
+   * state. This allows stats flushes to skip text readouts that have not changed.
+   * @return true if the text readout was set since the previous call to latchChanged().
+   */
+  virtual bool latchChanged() PURE;
 };
 
 using TextReadoutSharedPtr = RefcountPtr<TextReadout>;
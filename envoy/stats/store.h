@@ -1,7 +1,9 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "envoy/common/optref.h"
@@ -18,6 +20,10 @@ namespace Event {
 class Dispatcher;
 }
 
+namespace Thread {
+class ThreadFactory;
+}
+
 namespace ThreadLocal {
 class Instance;
 }
@@ -264,6 +270,24 @@ public:
    */
   virtual void mergeHistograms(PostMergeCb merge_complete_cb) PURE;
 
+  /**
+   * Configure helper threads used to merge histograms during mergeHistograms(). The parent
+   * histograms are partitioned across the helpers and the calling thread, which waits for all
+   * partitions to complete before invoking the merge callback. A value of 0 merges every
+   * histogram on the calling thread, which is the default.
+   * @param thread_factory used to create the helper threads.
+   * @param num_threads the number of helper threads to create.
+   */
+  virtual void setHistogramMergeThreads(Thread::ThreadFactory& thread_factory,
+                                        uint32_t num_threads) PURE;
+
+  /**
+   * Selects counters to be created with per-thread shards. See
+   * Allocator::setShardedCounters().
+   * @param tag_extracted_names the tag-extracted names of the counters to shard.
+   */
+  virtual void setShardedCounters(const std::vector<std::string>& tag_extracted_names) PURE;
+
   /**
    * Set predicates for filtering stats to be flushed to sinks.
    * Note that if the sink predicates object is set, we do not send non-sink stats over to the
@@ -216,10 +216,17 @@ public:
   virtual SharedConstAddressVector addressListOrNull() const PURE;
 
   /**
-   * @return host specific stats.
+   * @return host specific stats. Implementations may allocate the stats on first call, so callers
+   *         that only read stats should prefer statsIfAllocated().
    */
   virtual HostStats& stats() const PURE;
 
+  /**
+   * @return host specific stats, or nullptr if they have not been allocated yet because nothing
+   *         has called stats(), in which case every host stat reads as zero. Never allocates.
+   */
+  virtual HostStats* statsIfAllocated() const { return &stats(); }
+
   /**
    * @return custom stats for multi-dimensional load balancing.
    */
@@ -714,6 +714,8 @@ public:
   COUNTER(upstream_cx_none_healthy)                                                                \
   COUNTER(upstream_cx_overflow)                                                                    \
   COUNTER(upstream_cx_pool_overflow)                                                               \
+  COUNTER(upstream_cx_preconnect_adaptive)                                                         \
+  COUNTER(upstream_cx_preconnect_adaptive_unused)                                                  \
   COUNTER(upstream_cx_protocol_error)                                                              \
   COUNTER(upstream_cx_rx_bytes_total)                                                              \
   COUNTER(upstream_cx_total)                                                                       \
@@ -948,6 +950,13 @@ public:
    */
   virtual float perUpstreamPreconnectRatio() const PURE;
 
+  /**
+   * @return the decay time constant of the per-pool stream arrival rate and connect latency
+   *         estimates used for adaptive preconnecting, or absl::nullopt if adaptive
+   *         preconnecting is disabled.
+   */
+  virtual const absl::optional<std::chrono::milliseconds> adaptivePreconnectWindow() const PURE;
+
   /**
    * @return how many streams should be anticipated per each current stream.
    */
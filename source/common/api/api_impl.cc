@@ -7,6 +7,7 @@
 
 #include "source/common/common/thread.h"
 #include "source/common/event/dispatcher_impl.h"
+#include "source/common/protobuf/utility.h"
 
 namespace Envoy {
 namespace Api {
@@ -28,8 +29,15 @@ Event::DispatcherPtr Impl::allocateDispatcher(const std::string& name) {
 Event::DispatcherPtr
 Impl::allocateDispatcher(const std::string& name,
                          const Event::ScaledRangeTimerManagerFactory& scaled_timer_factory) {
+  absl::optional<Event::TimerWheelConfig> timer_wheel;
+  if (bootstrap_.has_worker_timer_wheel()) {
+    const auto& config = bootstrap_.worker_timer_wheel();
+    timer_wheel = Event::TimerWheelConfig{
+        std::chrono::milliseconds(PROTOBUF_GET_MS_OR_DEFAULT(config, tick, 10)),
+        PROTOBUF_GET_WRAPPED_OR_DEFAULT(config, slots, 4096)};
+  }
   return std::make_unique<Event::DispatcherImpl>(name, *this, time_system_, scaled_timer_factory,
-                                                 watermark_factory_);
+                                                 watermark_factory_, timer_wheel);
 }
 
 Event::DispatcherPtr Impl::allocateDispatcher(const std::string& name,
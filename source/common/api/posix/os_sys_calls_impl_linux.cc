@@ -2,7 +2,9 @@
 #error "Linux platform file is part of non-Linux build."
 #endif
 
+#include <fcntl.h>
 #include <sched.h>
+#include <unistd.h>
 
 #include <cerrno>
 
@@ -22,5 +24,21 @@ SysCallIntResult LinuxOsSysCallsImpl::setns(int fd, int nstype) const {
   return {rc, errno};
 }
 
+SysCallIntResult LinuxOsSysCallsImpl::pipe2(int pipefd[2], int flags) {
+  const int rc = ::pipe2(pipefd, flags);
+  return {rc, rc != -1 ? 0 : errno};
+}
+
+SysCallSizeResult LinuxOsSysCallsImpl::splice(int fd_in, int fd_out, size_t length,
+                                              unsigned int flags) {
+  const ssize_t rc = ::splice(fd_in, nullptr, fd_out, nullptr, length, flags);
+  return {rc, rc != -1 ? 0 : errno};
+}
+
+SysCallIntResult LinuxOsSysCallsImpl::fcntl(int fd, int cmd, int arg) {
+  const int rc = ::fcntl(fd, cmd, arg);
+  return {rc, rc != -1 ? 0 : errno};
+}
+
 } // namespace Api
 } // namespace Envoy
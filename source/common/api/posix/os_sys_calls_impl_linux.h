@@ -16,6 +16,9 @@ public:
   // Api::LinuxOsSysCalls
   SysCallIntResult sched_getaffinity(pid_t pid, size_t cpusetsize, cpu_set_t* mask) override;
   SysCallIntResult setns(int fd, int nstype) const override;
+  SysCallIntResult pipe2(int pipefd[2], int flags) override;
+  SysCallSizeResult splice(int fd_in, int fd_out, size_t length, unsigned int flags) override;
+  SysCallIntResult fcntl(int fd, int cmd, int arg) override;
 };
 
 using LinuxOsSysCallsSingleton = ThreadSafeSingleton<LinuxOsSysCallsImpl>;
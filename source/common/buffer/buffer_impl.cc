@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "source/common/common/assert.h"
 
@@ -19,9 +20,97 @@ namespace {
 constexpr uint64_t CopyThreshold = 512;
 } // namespace
 
-thread_local absl::InlinedVector<Slice::StoragePtr,
-                                 OwnedImpl::OwnedImplReservationSlicesOwnerMultiple::free_list_max_>
-    OwnedImpl::OwnedImplReservationSlicesOwnerMultiple::free_list_;
+struct SliceStoragePool::ThreadCache {
+  std::array<std::vector<StoragePtr>, NumSizeClasses> free_lists_;
+  uint64_t cached_bytes_{};
+  Stats stats_;
+};
+
+std::atomic<uint32_t> SliceStoragePool::max_blocks_per_class_{DefaultMaxBlocksPerClass};
+std::atomic<uint64_t> SliceStoragePool::max_cached_bytes_{DefaultMaxCachedBytes};
+thread_local SliceStoragePool::ThreadCache* SliceStoragePool::thread_cache_{};
+thread_local bool SliceStoragePool::thread_cache_destroyed_{};
+
+SliceStoragePool::ThreadCache* SliceStoragePool::threadCache() {
+  if (thread_cache_ == nullptr && !thread_cache_destroyed_) {
+    // The holder frees the cache when the thread exits. Anything released after that goes
+    // straight back to the heap.
+    struct Holder {
+      ~Holder() {
+        delete thread_cache_;
+        thread_cache_ = nullptr;
+        thread_cache_destroyed_ = true;
+      }
+    };
+    static thread_local Holder holder;
+    thread_cache_ = new ThreadCache();
+  }
+  return thread_cache_;
+}
+
+SliceStoragePool::StoragePtr SliceStoragePool::allocate(uint64_t size) {
+  ASSERT(size % PageSize == 0);
+  ThreadCache* cache = threadCache();
+  if (cache != nullptr) {
+    if (size != 0 && size <= MaxPooledSize) {
+      auto& free_list = cache->free_lists_[sizeClass(size)];
+      if (!free_list.empty()) {
+        StoragePtr storage = std::move(free_list.back());
+        free_list.pop_back();
+        cache->cached_bytes_ -= size;
+        ++cache->stats_.hits_;
+        return storage;
+      }
+    }
+    ++cache->stats_.misses_;
+  }
+  return StoragePtr{new uint8_t[size]};
+}
+
+void SliceStoragePool::release(StoragePtr storage, uint64_t size) {
+  if (storage == nullptr) {
+    return;
+  }
+  ASSERT(size % PageSize == 0);
+  ThreadCache* cache = threadCache();
+  if (cache == nullptr) {
+    return;
+  }
+  if (size != 0 && size <= MaxPooledSize) {
+    auto& free_list = cache->free_lists_[sizeClass(size)];
+    if (free_list.size() < max_blocks_per_class_.load(std::memory_order_relaxed) &&
+        cache->cached_bytes_ + size <= max_cached_bytes_.load(std::memory_order_relaxed)) {
+      free_list.push_back(std::move(storage));
+      cache->cached_bytes_ += size;
+      ++cache->stats_.recycled_;
+      return;
+    }
+  }
+  ++cache->stats_.overflows_;
+}
+
+void SliceStoragePool::setLimits(uint32_t max_blocks_per_class, uint64_t max_cached_bytes) {
+  max_blocks_per_class_.store(max_blocks_per_class, std::memory_order_relaxed);
+  max_cached_bytes_.store(max_cached_bytes, std::memory_order_relaxed);
+}
+
+const SliceStoragePool::Stats& SliceStoragePool::threadStats() {
+  static const Stats empty_stats;
+  const ThreadCache* cache = threadCache();
+  return cache != nullptr ? cache->stats_ : empty_stats;
+}
+
+uint64_t SliceStoragePool::threadCachedBytes() {
+  const ThreadCache* cache = threadCache();
+  return cache != nullptr ? cache->cached_bytes_ : 0;
+}
+
+void SliceStoragePool::clearThreadCacheForTest() {
+  ThreadCache* cache = threadCache();
+  if (cache != nullptr) {
+    *cache = ThreadCache();
+  }
+}
 
 uint64_t Slice::prepend(const void* data, uint64_t size) {
   const uint8_t* src = static_cast<const uint8_t*>(data);
@@ -381,6 +470,28 @@ void OwnedImpl::move(Instance& rhs, uint64_t length, bool reset_drain_trackers_a
   other.postProcess();
 }
 
+void OwnedImpl::moveSlices(OwnedImpl& rhs, uint64_t length) {
+  ASSERT(&rhs != this);
+  ASSERT(length <= rhs.length_);
+  while (length != 0 && !rhs.slices_.empty()) {
+    Slice slice = std::move(rhs.slices_.front());
+    rhs.slices_.pop_front();
+    const uint64_t slice_size = slice.dataSize();
+    rhs.length_ -= slice_size;
+    if (slice_size > length) {
+      // The unmoved tail of the slice must stay in `rhs`, but its storage can't be shared. Copy
+      // it back so that the moved bytes keep their original storage.
+      rhs.prepend(absl::string_view(reinterpret_cast<const char*>(slice.data()) + length,
+                                    slice_size - length));
+    }
+    length -= std::min(slice_size, length);
+    slice.callAndClearDrainTrackersAndCharges();
+    length_ += slice_size;
+    slices_.emplace_back(std::move(slice));
+  }
+  rhs.postProcess();
+}
+
 Reservation OwnedImpl::reserveForRead() {
   return reserveWithMaxLength(default_read_reservation_size_);
 }
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <deque>
 #include <memory>
@@ -19,6 +21,91 @@
 namespace Envoy {
 namespace Buffer {
 
+/**
+ * A per-thread cache of slice backing storage, bucketed into page-multiple size classes. Slice
+ * storage is always sized in multiples of the page size, so every block cached in a size class
+ * can satisfy any request for that class without waste. Requests larger than the largest size
+ * class, and requests made while the thread is tearing down its thread locals, bypass the cache
+ * and go straight to the heap.
+ */
+class SliceStoragePool {
+public:
+  using StoragePtr = std::unique_ptr<uint8_t[]>;
+
+  // Per-thread counters describing how effective the cache is.
+  struct Stats {
+    // Allocations satisfied from the cache.
+    uint64_t hits_{};
+    // Allocations that went to the heap.
+    uint64_t misses_{};
+    // Released blocks that were kept in the cache.
+    uint64_t recycled_{};
+    // Released blocks that were returned to the heap because they were larger than the largest
+    // size class or because the cache was full.
+    uint64_t overflows_{};
+  };
+
+  // The page size slices are rounded up to by Slice::sliceSize().
+  static constexpr uint64_t PageSize = 4096;
+  // Size classes cover 4KiB through 64KiB.
+  static constexpr uint32_t NumSizeClasses = 16;
+  static constexpr uint64_t MaxPooledSize = NumSizeClasses * PageSize;
+  static constexpr uint32_t DefaultMaxBlocksPerClass = 8;
+  static constexpr uint64_t DefaultMaxCachedBytes = 1024 * 1024;
+
+  /**
+   * Get backing storage for a slice, reusing a cached block if one of the right size is available.
+   * @param size the size of the storage in bytes. Must be a multiple of PageSize.
+   * @return storage of exactly the requested size.
+   */
+  static StoragePtr allocate(uint64_t size);
+
+  /**
+   * Return backing storage to the calling thread's cache, or free it if the cache for its size
+   * class is full.
+   * @param storage the storage to release. May be null, in which case this is a no-op.
+   * @param size the size of the storage in bytes, as passed to allocate().
+   */
+  static void release(StoragePtr storage, uint64_t size);
+
+  /**
+   * Set the caching limits applied by every thread. Blocks already cached above a lowered limit
+   * are not evicted, but no more are cached until the thread is back under the limit.
+   * @param max_blocks_per_class maximum number of free blocks cached per size class. 0 disables
+   *        caching.
+   * @param max_cached_bytes maximum total bytes of free blocks cached across all size classes.
+   */
+  static void setLimits(uint32_t max_blocks_per_class, uint64_t max_cached_bytes);
+
+  /**
+   * @return the cache counters for the calling thread.
+   */
+  static const Stats& threadStats();
+
+  /**
+   * @return the number of bytes held in free blocks by the calling thread's cache.
+   */
+  static uint64_t threadCachedBytes();
+
+  /**
+   * Free all blocks cached by the calling thread and reset its counters.
+   */
+  static void clearThreadCacheForTest();
+
+private:
+  struct ThreadCache;
+
+  static uint32_t sizeClass(uint64_t size) { return size / PageSize - 1; }
+  static ThreadCache* threadCache();
+
+  static std::atomic<uint32_t> max_blocks_per_class_;
+  static std::atomic<uint64_t> max_cached_bytes_;
+  // Raw pointer and flag rather than an object with a destructor so that slices destroyed late
+  // in thread teardown can still safely check whether the cache is available.
+  static thread_local ThreadCache* thread_cache_;
+  static thread_local bool thread_cache_destroyed_;
+};
+
 /**
  * A Slice manages a contiguous block of bytes.
  * The block is arranged like this:
@@ -57,7 +144,7 @@ public:
    * @param account the account to charge.
    */
   Slice(uint64_t min_capacity, const BufferMemoryAccountSharedPtr& account)
-      : capacity_(sliceSize(min_capacity)), storage_(new uint8_t[capacity_]),
+      : capacity_(sliceSize(min_capacity)), storage_(SliceStoragePool::allocate(capacity_)),
         base_(storage_.get()) {
     if (account) {
       account->charge(capacity_);
@@ -114,6 +201,7 @@ public:
   Slice& operator=(Slice&& rhs) noexcept {
     if (this != &rhs) {
       callAndClearDrainTrackersAndCharges();
+      SliceStoragePool::release(std::move(storage_), capacity_);
 
       capacity_ = rhs.capacity_;
       storage_ = std::move(rhs.storage_);
@@ -142,6 +230,7 @@ public:
     if (releasor_) {
       releasor_();
     }
+    SliceStoragePool::release(std::move(storage_), capacity_);
   }
 
   /**
@@ -351,7 +440,8 @@ public:
    * @return a recommended slice size, in bytes.
    */
   static uint64_t sliceSize(uint64_t data_size) {
-    static constexpr uint64_t PageSize = 4096;
+    // Slices are sized in the pages the storage pool's size classes are built from.
+    constexpr uint64_t PageSize = SliceStoragePool::PageSize;
     const uint64_t num_pages = (data_size + PageSize - 1) / PageSize;
     return num_pages * PageSize;
   }
@@ -359,13 +449,13 @@ public:
   /**
    * Create new backend storage with min capacity. This method will create a recommended capacity
    * which will bigger or equal to the min capacity and create new backend storage based on the
-   * recommended capacity.
+   * recommended capacity. The storage is taken from the thread's SliceStoragePool when possible.
    * @param min_capacity the min capacity of new created backend storage.
    * @return a backend storage for slice.
    */
   static inline SizedStorage newStorage(uint64_t min_capacity) {
     const uint64_t slice_size = sliceSize(min_capacity);
-    return {StoragePtr{new uint8_t[slice_size]}, static_cast<size_t>(slice_size)};
+    return {SliceStoragePool::allocate(slice_size), static_cast<size_t>(slice_size)};
   }
 
 protected:
@@ -678,6 +768,18 @@ public:
   // LibEventInstance
   void postProcess() override;
 
+  /**
+   * Move the first `length` bytes of `rhs` into this buffer by transferring ownership of the
+   * slices holding them. Unlike move(), slices are never coalesced or copied, so the memory backing
+   * the moved bytes stays valid and unchanged until this buffer drains it. If `length` ends in the
+   * middle of a slice, the whole slice is moved to this buffer and its remaining bytes are also
+   * copied back to the front of `rhs`. Drain trackers and account charges of every moved slice are
+   * released as if it had been drained from `rhs`.
+   * @param rhs the buffer to move bytes from.
+   * @param length the number of bytes to move.
+   */
+  void moveSlices(OwnedImpl& rhs, uint64_t length);
+
   /**
    * Create a new slice at the end of the buffer, and copy the supplied content into it.
    * @param data start of the content to copy.
@@ -763,32 +865,17 @@ private:
 
   struct OwnedImplReservationSlicesOwnerMultiple : public OwnedImplReservationSlicesOwner {
   public:
-    static constexpr uint32_t free_list_max_ = Buffer::Reservation::MAX_SLICES_;
-
-    OwnedImplReservationSlicesOwnerMultiple() : free_list_ref_(free_list_) {}
     ~OwnedImplReservationSlicesOwnerMultiple() override {
+      // Return storage that was never committed to the thread's pool, most recently reserved
+      // first, so that the next reservation gets the earliest slices back.
       for (auto r = owned_storages_.rbegin(); r != owned_storages_.rend(); r++) {
-        if (r->mem_ != nullptr) {
-          ASSERT(r->len_ == Slice::default_slice_size_);
-          if (free_list_ref_.size() < free_list_max_) {
-            free_list_ref_.push_back(std::move(r->mem_));
-          }
-        }
+        SliceStoragePool::release(std::move(r->mem_), r->len_);
       }
     }
 
     Slice::SizedStorage newStorage() {
       ASSERT(Slice::sliceSize(Slice::default_slice_size_) == Slice::default_slice_size_);
-
-      Slice::SizedStorage storage{nullptr, Slice::default_slice_size_};
-      if (!free_list_ref_.empty()) {
-        storage.mem_ = std::move(free_list_ref_.back());
-        free_list_ref_.pop_back();
-      } else {
-        storage.mem_.reset(new uint8_t[Slice::default_slice_size_]);
-      }
-
-      return storage;
+      return Slice::newStorage(Slice::default_slice_size_);
     }
 
     absl::Span<Slice::SizedStorage> ownedStorages() override {
@@ -796,19 +883,13 @@ private:
     }
 
     absl::InlinedVector<Slice::SizedStorage, Buffer::Reservation::MAX_SLICES_> owned_storages_;
-
-  private:
-    // Thread local resolving introduces additional overhead. Initialize this reference once when
-    // constructing the owner to reduce thread local resolving to improve performance.
-    absl::InlinedVector<Slice::StoragePtr, free_list_max_>& free_list_ref_;
-
-    // Simple thread local cache to reduce unnecessary memory allocation and release. This cache
-    // is currently only used for multiple slices reservation because of the additional overhead
-    // that thread local resolving would introduce.
-    static thread_local absl::InlinedVector<Slice::StoragePtr, free_list_max_> free_list_;
   };
 
   struct OwnedImplReservationSlicesOwnerSingle : public OwnedImplReservationSlicesOwner {
+    ~OwnedImplReservationSlicesOwnerSingle() override {
+      SliceStoragePool::release(std::move(owned_storage_.mem_), owned_storage_.len_);
+    }
+
     absl::Span<Slice::SizedStorage> ownedStorages() override {
       return absl::MakeSpan(&owned_storage_, 1);
     }
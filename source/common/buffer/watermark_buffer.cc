@@ -244,6 +244,16 @@ WatermarkBufferFactory::WatermarkBufferFactory(
                     ? config.minimum_account_to_track_power_of_two() - 1
                     : kEffectivelyDisableTrackingBitshift) {}
 
+void WatermarkBufferFactory::configureSliceStoragePool(
+    const envoy::config::overload::v3::BufferFactoryConfig& config) {
+  SliceStoragePool::setLimits(config.has_max_cached_slices_per_size_class()
+                                  ? config.max_cached_slices_per_size_class().value()
+                                  : SliceStoragePool::DefaultMaxBlocksPerClass,
+                              config.has_max_cached_slice_bytes_per_thread()
+                                  ? config.max_cached_slice_bytes_per_thread().value()
+                                  : SliceStoragePool::DefaultMaxCachedBytes);
+}
+
 WatermarkBufferFactory::~WatermarkBufferFactory() {
   for (auto& account_set : size_class_account_sets_) {
     ASSERT(account_set.empty(),
@@ -192,6 +192,13 @@ class WatermarkBufferFactory : public WatermarkFactory {
 public:
   WatermarkBufferFactory(const envoy::config::overload::v3::BufferFactoryConfig& config);
 
+  /**
+   * Applies the slice storage cache limits of the config. The limits are process wide, so this is
+   * called once at server initialization rather than by the factory of each dispatcher.
+   */
+  static void
+  configureSliceStoragePool(const envoy::config::overload::v3::BufferFactoryConfig& config);
+
   // Buffer::WatermarkFactory
   ~WatermarkBufferFactory() override;
   InstancePtr createBuffer(std::function<void()> below_low_watermark,
@@ -43,6 +43,11 @@ public:
     return true;
   }
 
+  /**
+   * @return true if no entries have been added.
+   */
+  bool empty() const { return root_.children_.empty() && !hasValue(root_); }
+
   /**
    * Finds the entry associated with the key.
    * @param key the key used to find.
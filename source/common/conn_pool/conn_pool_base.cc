@@ -1,5 +1,8 @@
 #include "source/common/conn_pool/conn_pool_base.h"
 
+#include <cmath>
+#include <limits>
+
 #include "envoy/server/overload/load_shed_point.h"
 
 #include "source/common/common/assert.h"
@@ -21,6 +24,44 @@ int64_t currentUnusedCapacity(const std::list<ActiveClientPtr>& connecting_clien
 }
 } // namespace
 
+AdaptivePreconnectEstimator::AdaptivePreconnectEstimator(std::chrono::milliseconds window)
+    : window_seconds_(std::chrono::duration<double>(window).count()) {}
+
+void AdaptivePreconnectEstimator::onStreamArrival(MonotonicTime now) {
+  // Each arrival adds 1/window to a count which decays with time constant window, so at a steady
+  // arrival rate the value converges on that rate, and it decays towards zero when idle.
+  arrival_rate_ = arrivalRate(now) + 1.0 / window_seconds_;
+  last_arrival_ = now;
+}
+
+void AdaptivePreconnectEstimator::onConnectLatency(std::chrono::milliseconds latency) {
+  const double sample = std::chrono::duration<double>(latency).count();
+  if (!connect_latency_seconds_.has_value()) {
+    connect_latency_seconds_ = sample;
+    return;
+  }
+  // Use the same gain as TCP's smoothed round-trip time estimator (RFC 6298).
+  *connect_latency_seconds_ += (sample - *connect_latency_seconds_) / 8;
+}
+
+double AdaptivePreconnectEstimator::arrivalRate(MonotonicTime now) const {
+  if (arrival_rate_ == 0) {
+    return 0;
+  }
+  const double elapsed = std::chrono::duration<double>(now - last_arrival_).count();
+  return arrival_rate_ * std::exp(-elapsed / window_seconds_);
+}
+
+uint32_t AdaptivePreconnectEstimator::anticipatedStreams(MonotonicTime now) const {
+  if (!connect_latency_seconds_.has_value()) {
+    return 0;
+  }
+  // By Little's law, the streams arriving during one connection establishment.
+  const double expected = arrivalRate(now) * *connect_latency_seconds_;
+  return static_cast<uint32_t>(
+      std::round(std::min<double>(expected, std::numeric_limits<uint32_t>::max())));
+}
+
 std::string ConnPoolImplBase::dumpState() const { return fmt::format("State: {}", *this); }
 
 void ConnPoolImplBase::assertCapacityCountsAreCorrect() {
@@ -60,6 +101,11 @@ ConnPoolImplBase::ConnPoolImplBase(
       upstream_ready_cb_(dispatcher_.createSchedulableCallback([this]() { onUpstreamReady(); })),
       create_new_connection_load_shed_(overload_manager.getLoadShedPoint(
           Server::LoadShedPointName::get().ConnectionPoolNewConnection)) {
+  const absl::optional<std::chrono::milliseconds> adaptive_preconnect_window =
+      host_->cluster().adaptivePreconnectWindow();
+  if (adaptive_preconnect_window.has_value()) {
+    adaptive_preconnect_.emplace(adaptive_preconnect_window.value());
+  }
   ENVOY_LOG_ONCE_IF(trace, create_new_connection_load_shed_ == nullptr,
                     "LoadShedPoint envoy.load_shed_points.connection_pool_new_connection is not "
                     "found. Is it configured?");
@@ -161,6 +207,26 @@ float ConnPoolImplBase::perUpstreamPreconnectRatio() const {
   return host_->cluster().perUpstreamPreconnectRatio();
 }
 
+bool ConnPoolImplBase::shouldAdaptivelyPreconnect(int64_t excluded_capacity) const {
+  // As with the preconnect ratio, don't make unhealthy hosts do extra work.
+  if (!adaptive_preconnect_.has_value() || is_draining_for_deletion_ ||
+      host_->coarseHealth() != Upstream::Host::Health::Healthy) {
+    return false;
+  }
+  // Keep enough unused capacity, connected or connecting, for the pending streams plus the
+  // streams expected to arrive before another connection could be established.
+  const uint32_t anticipated_streams =
+      adaptive_preconnect_->anticipatedStreams(dispatcher_.timeSource().monotonicTime());
+  const bool result = static_cast<int64_t>(pending_streams_.size() + anticipated_streams) >
+                      connecting_and_connected_stream_capacity_ - excluded_capacity;
+  ENVOY_LOG(trace,
+            "adaptive shouldCreateNewConnection returns {} for pending {} anticipated {} "
+            "connecting_and_connected_capacity {}",
+            result, pending_streams_.size(), anticipated_streams,
+            connecting_and_connected_stream_capacity_);
+  return result;
+}
+
 ConnPoolImplBase::ConnectionResult ConnPoolImplBase::tryCreateNewConnections() {
   ConnPoolImplBase::ConnectionResult result;
   // Somewhat arbitrarily cap the number of connections preconnected due to new
@@ -182,8 +248,11 @@ ConnPoolImplBase::ConnectionResult ConnPoolImplBase::tryCreateNewConnections() {
 
 ConnPoolImplBase::ConnectionResult
 ConnPoolImplBase::tryCreateNewConnection(float global_preconnect_ratio) {
-  // There are already enough Connecting connections for the number of queued streams.
-  if (!shouldCreateNewConnection(global_preconnect_ratio)) {
+  // If there are already enough Connecting connections for the number of queued streams, only
+  // connect if adaptive preconnecting predicts more capacity is needed. That prediction is
+  // per-upstream, so it does not apply to global preconnect.
+  const bool adaptive_only = !shouldCreateNewConnection(global_preconnect_ratio);
+  if (adaptive_only && (global_preconnect_ratio != 0 || !shouldAdaptivelyPreconnect())) {
     return ConnectionResult::ShouldNotConnect;
   }
   ENVOY_LOG(trace, "creating new preconnect connection");
@@ -216,6 +285,10 @@ ConnPoolImplBase::tryCreateNewConnection(float global_preconnect_ratio) {
                   static_cast<uint64_t>(client->currentUnusedCapacity()),
               dumpState());
     ASSERT(client->real_host_description_);
+    if (adaptive_only) {
+      host_->cluster().trafficStats()->upstream_cx_preconnect_adaptive_.inc();
+      client->unused_adaptive_preconnect_ = true;
+    }
     // Increase the connecting capacity to reflect the streams this connection can serve.
     incrConnectingAndConnectedStreamCapacity(client->currentUnusedCapacity(), *client);
     LinkedList::moveIntoList(std::move(client), owningList(client->state()));
@@ -245,6 +318,7 @@ void ConnPoolImplBase::attachStreamToClient(Envoy::ConnectionPool::ActiveClient&
     return;
   }
   ENVOY_CONN_LOG(debug, "creating stream", client);
+  client.unused_adaptive_preconnect_ = false;
 
   // Latch capacity before updating remaining streams.
   uint64_t capacity = client.currentUnusedCapacity();
@@ -325,6 +399,10 @@ ConnectionPool::Cancellable* ConnPoolImplBase::newStreamImpl(AttachContext& cont
   ASSERT(!deferred_deleting_, dumpState());
   assertCapacityCountsAreCorrect();
 
+  if (adaptive_preconnect_.has_value()) {
+    adaptive_preconnect_->onStreamArrival(dispatcher_.timeSource().monotonicTime());
+  }
+
   if (!ready_clients_.empty()) {
     ActiveClient& client = *ready_clients_.front();
     ENVOY_CONN_LOG(debug, "using existing fully connected connection", client);
@@ -567,6 +645,9 @@ void ConnPoolImplBase::onConnectionEvent(ActiveClient& client, absl::string_view
     ENVOY_CONN_LOG(debug, "client disconnected, failure reason: {}", client, failure_reason);
 
     Envoy::Upstream::reportUpstreamCxDestroy(host_, event);
+    if (client.unused_adaptive_preconnect_) {
+      host_->cluster().trafficStats()->upstream_cx_preconnect_adaptive_unused_.inc();
+    }
     const bool incomplete_stream = client.closingWithIncompleteStream();
     if (incomplete_stream) {
       Envoy::Upstream::reportUpstreamCxDestroyActiveRequest(host_, event);
@@ -647,6 +728,9 @@ void ConnPoolImplBase::onConnectionEvent(ActiveClient& client, absl::string_view
     ENVOY_BUG(connecting_stream_capacity_ >= client.currentUnusedCapacity(), dumpState());
     connecting_stream_capacity_ -= client.currentUnusedCapacity();
     client.has_handshake_completed_ = true;
+    if (adaptive_preconnect_.has_value()) {
+      adaptive_preconnect_->onConnectLatency(client.conn_connect_ms_->elapsed());
+    }
     client.conn_connect_ms_->complete();
     client.conn_connect_ms_.reset();
     if (client.state() == ActiveClient::State::Connecting ||
@@ -733,8 +817,13 @@ bool ConnPoolImplBase::connectingConnectionIsExcess(const ActiveClient& client)
   // If preconnect ratio is set, it also factors in the anticipated load based on both queued
   // streams and active streams, and makes sure the connecting capacity would still be sufficient to
   // serve that even with the most recent client removed.
+  //
+  // With adaptive preconnecting, the client is also needed if removing it would leave less unused
+  // capacity than is expected to be needed while a new connection is established.
   return (pending_streams_.size() + num_active_streams_) * perUpstreamPreconnectRatio() <=
-         (connecting_stream_capacity_ - client.currentUnusedCapacity() + num_active_streams_);
+             (connecting_stream_capacity_ - client.currentUnusedCapacity() +
+              num_active_streams_) &&
+         !shouldAdaptivelyPreconnect(client.currentUnusedCapacity());
 }
 
 void ConnPoolImplBase::onPendingStreamCancel(PendingStream& stream,
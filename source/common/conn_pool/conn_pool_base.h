@@ -1,6 +1,7 @@
 #pragma once
 
 #include "envoy/common/conn_pool.h"
+#include "envoy/common/time.h"
 #include "envoy/event/dispatcher.h"
 #include "envoy/network/connection.h"
 #include "envoy/server/overload/overload_manager.h"
@@ -12,6 +13,7 @@
 #include "source/common/common/linked_object.h"
 
 #include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
 #include "fmt/ostream.h"
 
 namespace Envoy {
@@ -26,6 +28,33 @@ struct AttachContext {
   virtual ~AttachContext() = default;
 };
 
+// Predicts how much unused stream capacity a pool should hold so that streams arriving while a new
+// connection is being established do not have to queue. This keeps exponentially weighted moving
+// averages of the stream arrival rate and of the connection establishment latency. Each pool is
+// only used from the worker thread which owns it, so no synchronization is needed.
+class AdaptivePreconnectEstimator {
+public:
+  explicit AdaptivePreconnectEstimator(std::chrono::milliseconds window);
+
+  // Records a stream arriving at the pool.
+  void onStreamArrival(MonotonicTime now);
+  // Records the time taken to establish a connection to the upstream.
+  void onConnectLatency(std::chrono::milliseconds latency);
+
+  // Returns the stream arrival rate, in streams per second, decayed to the given time.
+  double arrivalRate(MonotonicTime now) const;
+  // Returns the number of streams expected to arrive while one new connection is established.
+  // This is zero until a connect latency has been observed.
+  uint32_t anticipatedStreams(MonotonicTime now) const;
+
+private:
+  const double window_seconds_;
+  MonotonicTime last_arrival_;
+  // Decayed count of arrivals divided by the window, which converges on the arrival rate.
+  double arrival_rate_{0};
+  absl::optional<double> connect_latency_seconds_;
+};
+
 // ActiveClient provides a base class for connection pool clients that handles connection timings
 // as well as managing the connection timeout.
 class ActiveClient : public LinkedObject<ActiveClient>,
@@ -143,6 +172,8 @@ public:
   Event::TimerPtr connection_duration_timer_;
   bool resources_released_{false};
   bool timed_out_{false};
+  // True if this connection was created by adaptive preconnecting and has not yet served a stream.
+  bool unused_adaptive_preconnect_{false};
   // TODO(danzh) remove this once http codec exposes the handshake state for h3.
   bool has_handshake_completed_{false};
 
@@ -347,6 +378,11 @@ protected:
 
   float perUpstreamPreconnectRatio() const;
 
+  // Returns true if adaptive preconnecting is enabled and the pool has less unused stream capacity
+  // than it expects to need while a new connection is established, excluding
+  // `excluded_capacity` from the capacity counted.
+  bool shouldAdaptivelyPreconnect(int64_t excluded_capacity = 0) const;
+
   ConnectionPool::Cancellable*
   addPendingStream(Envoy::ConnectionPool::PendingStreamPtr&& pending_stream) {
     LinkedList::moveIntoList(std::move(pending_stream), pending_streams_);
@@ -409,6 +445,9 @@ private:
   // The number of streams currently attached to clients.
   uint32_t num_active_streams_{0};
 
+  // Set if adaptive preconnecting is configured for the cluster.
+  absl::optional<AdaptivePreconnectEstimator> adaptive_preconnect_;
+
   // Whether the connection pool is currently in the process of closing
   // all connections so that it can be gracefully deleted.
   bool is_draining_for_deletion_{false};
@@ -55,22 +55,25 @@ DispatcherImpl::DispatcherImpl(const std::string& name, Api::Api& api,
 DispatcherImpl::DispatcherImpl(const std::string& name, Api::Api& api,
                                Event::TimeSystem& time_system,
                                const ScaledRangeTimerManagerFactory& scaled_timer_factory,
-                               const Buffer::WatermarkFactorySharedPtr& watermark_factory)
+                               const Buffer::WatermarkFactorySharedPtr& watermark_factory,
+                               const absl::optional<TimerWheelConfig>& timer_wheel)
     : DispatcherImpl(name, api.threadFactory(), api.timeSource(), api.fileSystem(), time_system,
                      scaled_timer_factory,
                      watermark_factory != nullptr
                          ? watermark_factory
                          : std::make_shared<Buffer::WatermarkBufferFactory>(
-                               api.bootstrap().overload_manager().buffer_factory_config())) {}
+                               api.bootstrap().overload_manager().buffer_factory_config()),
+                     timer_wheel) {}
 
 DispatcherImpl::DispatcherImpl(const std::string& name, Thread::ThreadFactory& thread_factory,
                                TimeSource& time_source, Filesystem::Instance& file_system,
                                Event::TimeSystem& time_system,
                                const ScaledRangeTimerManagerFactory& scaled_timer_factory,
-                               const Buffer::WatermarkFactorySharedPtr& watermark_factory)
+                               const Buffer::WatermarkFactorySharedPtr& watermark_factory,
+                               const absl::optional<TimerWheelConfig>& timer_wheel)
     : name_(name), thread_factory_(thread_factory), time_source_(time_source),
       file_system_(file_system), buffer_factory_(watermark_factory),
-      scheduler_(time_system.createScheduler(base_scheduler_, base_scheduler_)),
+      scheduler_(createScheduler(time_system, timer_wheel)),
       thread_local_delete_cb_(
           base_scheduler_.createSchedulableCallback([this]() -> void { runThreadLocalDelete(); })),
       deferred_delete_cb_(base_scheduler_.createSchedulableCallback(
@@ -232,6 +235,16 @@ Event::SchedulableCallbackPtr DispatcherImpl::createSchedulableCallback(std::fun
   });
 }
 
+SchedulerPtr DispatcherImpl::createScheduler(Event::TimeSystem& time_system,
+                                             const absl::optional<TimerWheelConfig>& timer_wheel) {
+  SchedulerPtr scheduler = time_system.createScheduler(base_scheduler_, base_scheduler_);
+  if (!timer_wheel.has_value()) {
+    return scheduler;
+  }
+  return std::make_unique<TimerWheelScheduler>(std::move(scheduler), time_system, *this,
+                                               timer_wheel.value());
+}
+
 TimerPtr DispatcherImpl::createTimerInternal(TimerCb cb) {
   return scheduler_->createTimer(
       [this, cb]() {
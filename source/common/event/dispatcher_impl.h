@@ -18,6 +18,7 @@
 #include "source/common/common/thread.h"
 #include "source/common/event/libevent.h"
 #include "source/common/event/libevent_scheduler.h"
+#include "source/common/event/timer_wheel_impl.h"
 #include "source/common/signal/fatal_error_handler.h"
 
 #include "absl/container/inlined_vector.h"
@@ -40,14 +41,17 @@ public:
   DispatcherImpl(const std::string& name, Api::Api& api, Event::TimeSystem& time_system);
   DispatcherImpl(const std::string& name, Api::Api& api, Event::TimeSystem& time_systems,
                  const Buffer::WatermarkFactorySharedPtr& watermark_factory);
+  // If timer_wheel is set, the timers created by the dispatcher are kept in a TimerWheelScheduler.
   DispatcherImpl(const std::string& name, Api::Api& api, Event::TimeSystem& time_system,
                  const ScaledRangeTimerManagerFactory& scaled_timer_factory,
-                 const Buffer::WatermarkFactorySharedPtr& watermark_factory);
+                 const Buffer::WatermarkFactorySharedPtr& watermark_factory,
+                 const absl::optional<TimerWheelConfig>& timer_wheel = absl::nullopt);
   DispatcherImpl(const std::string& name, Thread::ThreadFactory& thread_factory,
                  TimeSource& time_source, Filesystem::Instance& file_system,
                  Event::TimeSystem& time_system,
                  const ScaledRangeTimerManagerFactory& scaled_timer_factory,
-                 const Buffer::WatermarkFactorySharedPtr& watermark_factory);
+                 const Buffer::WatermarkFactorySharedPtr& watermark_factory,
+                 const absl::optional<TimerWheelConfig>& timer_wheel = absl::nullopt);
   ~DispatcherImpl() override;
 
   /**
@@ -125,6 +129,8 @@ private:
   };
   using WatchdogRegistrationPtr = std::unique_ptr<WatchdogRegistration>;
 
+  SchedulerPtr createScheduler(Event::TimeSystem& time_system,
+                               const absl::optional<TimerWheelConfig>& timer_wheel);
   TimerPtr createTimerInternal(TimerCb cb);
   void updateApproximateMonotonicTimeInternal();
   void runPostCallbacks();
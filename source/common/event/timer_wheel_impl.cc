@@ -0,0 +1,192 @@
+#include "source/common/event/timer_wheel_impl.h"
+
+#include <algorithm>
+
+#include "source/common/common/assert.h"
+#include "source/common/common/scope_tracker.h"
+
+namespace Envoy {
+namespace Event {
+
+class TimerWheelScheduler::WheelTimer : public Timer {
+public:
+  WheelTimer(TimerWheelScheduler& wheel, const TimerCb& cb, Dispatcher& dispatcher)
+      : wheel_(wheel), cb_(cb), dispatcher_(dispatcher) {
+    ASSERT(cb_);
+  }
+  ~WheelTimer() override { disableTimer(); }
+
+  // Timer
+  void disableTimer() override {
+    ASSERT(dispatcher_.isThreadSafe());
+    if (slot_ != nullptr) {
+      wheel_.remove(*this);
+    }
+    if (fallback_ != nullptr) {
+      fallback_->disableTimer();
+    }
+  }
+
+  void enableTimer(std::chrono::milliseconds duration, const ScopeTrackedObject* object) override {
+    disableTimer();
+    if (duration < wheel_.tick_) {
+      fallback().enableTimer(duration, object);
+      return;
+    }
+    object_ = object;
+    wheel_.add(*this, duration);
+  }
+
+  void enableHRTimer(std::chrono::microseconds duration,
+                     const ScopeTrackedObject* object) override {
+    disableTimer();
+    fallback().enableHRTimer(duration, object);
+  }
+
+  bool enabled() override {
+    ASSERT(dispatcher_.isThreadSafe());
+    return slot_ != nullptr || (fallback_ != nullptr && fallback_->enabled());
+  }
+
+  void fire() {
+    // The callback may destroy the timer.
+    if (object_ == nullptr) {
+      cb_();
+      return;
+    }
+    ScopeTrackerScopeState scope(object_, dispatcher_);
+    object_ = nullptr;
+    cb_();
+  }
+
+  TimerWheelScheduler& wheel_;
+  const TimerCb cb_;
+  Dispatcher& dispatcher_;
+  const ScopeTrackedObject* object_{};
+  // The tick at or after which the timer expires.
+  uint64_t expiry_tick_{};
+  // The slot holding the timer, or nullptr if it is not in the wheel.
+  Slot* slot_{};
+  WheelTimer* prev_{};
+  WheelTimer* next_{};
+
+private:
+  Timer& fallback() {
+    if (fallback_ == nullptr) {
+      fallback_ = wheel_.scheduler_->createTimer(cb_, dispatcher_);
+    }
+    return *fallback_;
+  }
+
+  // The timer used for durations the wheel can't represent, created on first use.
+  TimerPtr fallback_;
+};
+
+void TimerWheelScheduler::link(WheelTimer& timer, Slot& slot) {
+  timer.slot_ = &slot;
+  timer.prev_ = nullptr;
+  timer.next_ = slot.head_;
+  if (slot.head_ != nullptr) {
+    slot.head_->prev_ = &timer;
+  }
+  slot.head_ = &timer;
+}
+
+void TimerWheelScheduler::unlink(WheelTimer& timer) {
+  if (timer.prev_ != nullptr) {
+    timer.prev_->next_ = timer.next_;
+  } else {
+    timer.slot_->head_ = timer.next_;
+  }
+  if (timer.next_ != nullptr) {
+    timer.next_->prev_ = timer.prev_;
+  }
+  timer.slot_ = nullptr;
+  timer.prev_ = nullptr;
+  timer.next_ = nullptr;
+}
+
+TimerWheelScheduler::TimerWheelScheduler(SchedulerPtr&& scheduler, TimeSource& time_source,
+                                         Dispatcher& dispatcher, const TimerWheelConfig& config)
+    : scheduler_(std::move(scheduler)), time_source_(time_source), tick_(config.tick_),
+      start_(time_source_.monotonicTime()), slots_(config.slots_),
+      tick_timer_(scheduler_->createTimer([this]() { onTick(); }, dispatcher)) {
+  ASSERT(tick_.count() > 0);
+  ASSERT(!slots_.empty());
+}
+
+TimerWheelScheduler::~TimerWheelScheduler() { ASSERT(size_ == 0); }
+
+TimerPtr TimerWheelScheduler::createTimer(const TimerCb& cb, Dispatcher& dispatcher) {
+  return std::make_unique<WheelTimer>(*this, cb, dispatcher);
+}
+
+uint64_t TimerWheelScheduler::currentTick() const {
+  return (time_source_.monotonicTime() - start_) / tick_;
+}
+
+void TimerWheelScheduler::add(WheelTimer& timer, std::chrono::milliseconds duration) {
+  const auto deadline = time_source_.monotonicTime() - start_ + duration;
+  const auto tick = std::chrono::duration_cast<MonotonicTime::duration>(tick_);
+  // Round up, so that the timer never expires early.
+  timer.expiry_tick_ = (deadline + tick - MonotonicTime::duration(1)) / tick;
+  if (size_ == 0) {
+    // There is nothing to collect from the ticks elapsed while the wheel was empty.
+    processed_tick_ = currentTick();
+  }
+  link(timer, slots_[timer.expiry_tick_ % slots_.size()]);
+  ++size_;
+  if (!tick_timer_->enabled()) {
+    scheduleTick();
+  }
+}
+
+void TimerWheelScheduler::remove(WheelTimer& timer) {
+  ASSERT(size_ > 0);
+  unlink(timer);
+  --size_;
+}
+
+void TimerWheelScheduler::onTick() {
+  const uint64_t now_tick = currentTick();
+  // Visiting every slot once collects all the expired timers, however late the tick is. Slots are
+  // visited from the latest, and timers are pushed to the front of the lists, so that the expired
+  // timers fire in the order of their slots, then in the order they were enabled.
+  const uint64_t ticks = std::min<uint64_t>(now_tick - processed_tick_, slots_.size());
+  Slot expired;
+  for (uint64_t i = ticks; i > 0; --i) {
+    Slot& slot = slots_[(processed_tick_ + i) % slots_.size()];
+    WheelTimer* timer = slot.head_;
+    while (timer != nullptr) {
+      WheelTimer* next = timer->next_;
+      if (timer->expiry_tick_ <= now_tick) {
+        unlink(*timer);
+        link(*timer, expired);
+      }
+      timer = next;
+    }
+  }
+  processed_tick_ = std::max(processed_tick_, now_tick);
+
+  // Callbacks may disable or destroy the other expired timers, which removes them from the list.
+  while (expired.head_ != nullptr) {
+    WheelTimer& timer = *expired.head_;
+    remove(timer);
+    timer.fire();
+  }
+
+  if (size_ > 0) {
+    scheduleTick();
+  }
+}
+
+void TimerWheelScheduler::scheduleTick() {
+  // Wake up at the start of the next tick.
+  const auto since_start = time_source_.monotonicTime() - start_;
+  const auto next_tick = (since_start / tick_ + 1) * tick_;
+  tick_timer_->enableHRTimer(
+      std::chrono::ceil<std::chrono::microseconds>(next_tick - since_start));
+}
+
+} // namespace Event
+} // namespace Envoy
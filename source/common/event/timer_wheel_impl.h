@@ -0,0 +1,72 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "envoy/common/time.h"
+#include "envoy/event/dispatcher.h"
+#include "envoy/event/timer.h"
+
+namespace Envoy {
+namespace Event {
+
+/**
+ * Configuration of a TimerWheelScheduler.
+ */
+struct TimerWheelConfig {
+  // The granularity of the wheel. Timers of at least one tick expire up to one tick late.
+  std::chrono::milliseconds tick_;
+  // The number of slots of the wheel. Timers expiring more than tick_ * slots_ in the future share
+  // the slots with the earlier ones, and are skipped when their slot is visited too early.
+  uint32_t slots_;
+};
+
+/**
+ * Scheduler which keeps the timers in a hashed timing wheel, driven by a single timer of the
+ * wrapped scheduler, instead of arming a timer of the wrapped scheduler for each of them. Enabling
+ * and disabling a timer is O(1), and each tick only visits the timers hashed in its slot. This
+ * suits the large number of long timeouts which are armed and cancelled far more often than they
+ * expire, e.g. the idle timeouts of connections and streams. Timeouts shorter than a tick and high
+ * resolution timers keep using a timer of the wrapped scheduler.
+ */
+class TimerWheelScheduler : public Scheduler {
+public:
+  TimerWheelScheduler(SchedulerPtr&& scheduler, TimeSource& time_source, Dispatcher& dispatcher,
+                      const TimerWheelConfig& config);
+  ~TimerWheelScheduler() override;
+
+  // Scheduler
+  TimerPtr createTimer(const TimerCb& cb, Dispatcher& dispatcher) override;
+
+private:
+  class WheelTimer;
+
+  // Intrusive list of the timers in a slot, so that enabling and disabling a timer doesn't
+  // allocate.
+  struct Slot {
+    WheelTimer* head_{};
+  };
+
+  static void link(WheelTimer& timer, Slot& slot);
+  static void unlink(WheelTimer& timer);
+  void add(WheelTimer& timer, std::chrono::milliseconds duration);
+  void remove(WheelTimer& timer);
+  uint64_t currentTick() const;
+  void onTick();
+  void scheduleTick();
+
+  const SchedulerPtr scheduler_;
+  TimeSource& time_source_;
+  const std::chrono::milliseconds tick_;
+  const MonotonicTime start_;
+  std::vector<Slot> slots_;
+  // Drives the wheel while it holds timers.
+  const TimerPtr tick_timer_;
+  // The last tick whose expired timers were collected.
+  uint64_t processed_tick_{};
+  uint64_t size_{};
+};
+
+} // namespace Event
+} // namespace Envoy
@@ -11,9 +11,11 @@
 #include "source/common/http/headers.h"
 #include "source/common/http/utility.h"
 
+#include "absl/container/inlined_vector.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
+#include "absl/types/span.h"
 
 namespace Envoy {
 namespace Http {
@@ -43,15 +45,32 @@ CodeStatsImpl::CodeStatsImpl(Stats::SymbolTable& symbol_table)
   upstreamRqStatName(Code::ServiceUnavailable);
 }
 
-void CodeStatsImpl::incCounter(Stats::Scope& scope, const Stats::StatNameVec& names) const {
-  const Stats::SymbolTable::StoragePtr stat_name_storage = symbol_table_.join(names);
-  scope.counterFromStatName(Stats::StatName(stat_name_storage.get())).inc();
-}
+class CodeStatsImpl::CounterBatch {
+public:
+  explicit CounterBatch(Stats::SymbolTable& symbol_table) : symbol_table_(symbol_table) {}
 
-void CodeStatsImpl::incCounter(Stats::Scope& scope, Stats::StatName a, Stats::StatName b) const {
-  const Stats::SymbolTable::StoragePtr stat_name_storage = symbol_table_.join({a, b});
-  scope.counterFromStatName(Stats::StatName(stat_name_storage.get())).inc();
-}
+  void add(const Stats::StatNameVec& names) {
+    storage_.push_back(symbol_table_.join(names));
+    stat_names_.push_back(Stats::StatName(storage_.back().get()));
+  }
+
+  void inc(Stats::Scope& scope) {
+    counters_.resize(stat_names_.size());
+    scope.countersFromStatNames(stat_names_, absl::MakeSpan(counters_));
+    for (Stats::Counter* counter : counters_) {
+      counter->inc();
+    }
+  }
+
+private:
+  // Enough for everything chargeResponseStat() writes to the cluster scope.
+  static constexpr size_t MaxInlineCounters = 12;
+
+  Stats::SymbolTable& symbol_table_;
+  absl::InlinedVector<Stats::SymbolTable::StoragePtr, MaxInlineCounters> storage_;
+  absl::InlinedVector<Stats::StatName, MaxInlineCounters> stat_names_;
+  absl::InlinedVector<Stats::Counter*, MaxInlineCounters> counters_;
+};
 
 void CodeStatsImpl::recordHistogram(Stats::Scope& scope, const Stats::StatNameVec& names,
                                     Stats::Histogram::Unit unit, uint64_t count) const {
@@ -65,14 +84,21 @@ void CodeStatsImpl::chargeBasicResponseStat(Stats::Scope& scope, Stats::StatName
   ASSERT(&symbol_table_ == &scope.symbolTable());
 
   // Build a dynamic stat for the response code and increment it.
-  incCounter(scope, prefix, upstream_rq_completed_);
+  CounterBatch batch(symbol_table_);
+  addBasicResponseStats(batch, prefix, response_code, exclude_http_code_stats);
+  batch.inc(scope);
+}
+
+void CodeStatsImpl::addBasicResponseStats(CounterBatch& batch, Stats::StatName prefix,
+                                          Code response_code, bool exclude_http_code_stats) const {
+  batch.add({prefix, upstream_rq_completed_});
 
   if (!exclude_http_code_stats) {
     const Stats::StatName rq_group = upstreamRqGroup(response_code);
     if (!rq_group.empty()) {
-      incCounter(scope, prefix, rq_group);
+      batch.add({prefix, rq_group});
     }
-    incCounter(scope, prefix, upstreamRqStatName(response_code));
+    batch.add({prefix, upstreamRqStatName(response_code)});
   }
 }
 
@@ -81,60 +107,64 @@ void CodeStatsImpl::chargeResponseStat(const ResponseStatInfo& info,
   const Code code = static_cast<Code>(info.response_status_code_);
 
   ASSERT(&info.cluster_scope_.symbolTable() == &symbol_table_);
-  chargeBasicResponseStat(info.cluster_scope_, info.prefix_, code, exclude_http_code_stats);
+  CounterBatch cluster_batch(symbol_table_);
+  addBasicResponseStats(cluster_batch, info.prefix_, code, exclude_http_code_stats);
 
   const Stats::StatName rq_group = upstreamRqGroup(code);
   const Stats::StatName rq_code = upstreamRqStatName(code);
 
   // If the response is from a canary, also create canary stats.
   if (info.upstream_canary_) {
-    writeCategory(info, rq_group, rq_code, canary_);
+    writeCategory(cluster_batch, info, rq_group, rq_code, canary_);
   }
 
   // Split stats into external vs. internal.
   if (info.internal_request_) {
-    writeCategory(info, rq_group, rq_code, internal_);
+    writeCategory(cluster_batch, info, rq_group, rq_code, internal_);
   } else {
-    writeCategory(info, rq_group, rq_code, external_);
+    writeCategory(cluster_batch, info, rq_group, rq_code, external_);
+  }
+
+  // Handle per zone stats.
+  if (!info.from_zone_.empty() && !info.to_zone_.empty()) {
+    cluster_batch.add(
+        {info.prefix_, zone_, info.from_zone_, info.to_zone_, upstream_rq_completed_});
+    cluster_batch.add({info.prefix_, zone_, info.from_zone_, info.to_zone_, rq_group});
+    cluster_batch.add({info.prefix_, zone_, info.from_zone_, info.to_zone_, rq_code});
   }
+  cluster_batch.inc(info.cluster_scope_);
+
+  CounterBatch global_batch(symbol_table_);
 
   // Handle request virtual cluster.
   if (!info.request_vcluster_name_.empty()) {
-    incCounter(info.global_scope_, {vhost_, info.request_vhost_name_, vcluster_,
-                                    info.request_vcluster_name_, upstream_rq_completed_});
-    incCounter(info.global_scope_, {vhost_, info.request_vhost_name_, vcluster_,
-                                    info.request_vcluster_name_, rq_group});
-    incCounter(info.global_scope_,
-               {vhost_, info.request_vhost_name_, vcluster_, info.request_vcluster_name_, rq_code});
+    global_batch.add({vhost_, info.request_vhost_name_, vcluster_, info.request_vcluster_name_,
+                      upstream_rq_completed_});
+    global_batch.add(
+        {vhost_, info.request_vhost_name_, vcluster_, info.request_vcluster_name_, rq_group});
+    global_batch.add(
+        {vhost_, info.request_vhost_name_, vcluster_, info.request_vcluster_name_, rq_code});
   }
 
   // Handle route level stats.
   if (!info.request_route_name_.empty()) {
-    incCounter(info.global_scope_, {vhost_, info.request_vhost_name_, route_,
-                                    info.request_route_name_, upstream_rq_completed_});
-    incCounter(info.global_scope_,
-               {vhost_, info.request_vhost_name_, route_, info.request_route_name_, rq_group});
-    incCounter(info.global_scope_,
-               {vhost_, info.request_vhost_name_, route_, info.request_route_name_, rq_code});
-  }
-
-  // Handle per zone stats.
-  if (!info.from_zone_.empty() && !info.to_zone_.empty()) {
-    incCounter(info.cluster_scope_,
-               {info.prefix_, zone_, info.from_zone_, info.to_zone_, upstream_rq_completed_});
-    incCounter(info.cluster_scope_,
-               {info.prefix_, zone_, info.from_zone_, info.to_zone_, rq_group});
-    incCounter(info.cluster_scope_, {info.prefix_, zone_, info.from_zone_, info.to_zone_, rq_code});
+    global_batch.add({vhost_, info.request_vhost_name_, route_, info.request_route_name_,
+                      upstream_rq_completed_});
+    global_batch.add(
+        {vhost_, info.request_vhost_name_, route_, info.request_route_name_, rq_group});
+    global_batch.add({vhost_, info.request_vhost_name_, route_, info.request_route_name_, rq_code});
   }
+  global_batch.inc(info.global_scope_);
 }
 
-void CodeStatsImpl::writeCategory(const ResponseStatInfo& info, Stats::StatName rq_group,
-                                  Stats::StatName rq_code, Stats::StatName category) const {
-  incCounter(info.cluster_scope_, {info.prefix_, category, upstream_rq_completed_});
+void CodeStatsImpl::writeCategory(CounterBatch& batch, const ResponseStatInfo& info,
+                                  Stats::StatName rq_group, Stats::StatName rq_code,
+                                  Stats::StatName category) const {
+  batch.add({info.prefix_, category, upstream_rq_completed_});
   if (!rq_group.empty()) {
-    incCounter(info.cluster_scope_, {info.prefix_, category, rq_group});
+    batch.add({info.prefix_, category, rq_group});
   }
-  incCounter(info.cluster_scope_, {info.prefix_, category, rq_code});
+  batch.add({info.prefix_, category, rq_code});
 }
 
 void CodeStatsImpl::chargeResponseTiming(const ResponseTimingInfo& info) const {
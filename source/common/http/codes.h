@@ -56,10 +56,14 @@ public:
 private:
   friend class CodeStatsTest;
 
-  void writeCategory(const ResponseStatInfo& info, Stats::StatName rq_group,
+  // Collects the counters charged for one response in a scope, so that those missing from the
+  // thread-local cache are all resolved with a single Stats::Scope::countersFromStatNames() call.
+  class CounterBatch;
+
+  void addBasicResponseStats(CounterBatch& batch, Stats::StatName prefix, Code response_code,
+                             bool exclude_http_code_stats) const;
+  void writeCategory(CounterBatch& batch, const ResponseStatInfo& info, Stats::StatName rq_group,
                      Stats::StatName rq_code, Stats::StatName category) const;
-  void incCounter(Stats::Scope& scope, const Stats::StatNameVec& names) const;
-  void incCounter(Stats::Scope& scope, Stats::StatName a, Stats::StatName b) const;
   void recordHistogram(Stats::Scope& scope, const Stats::StatNameVec& names,
                        Stats::Histogram::Unit unit, uint64_t count) const;
 
@@ -213,6 +213,7 @@ bool HeaderMapImpl::operator==(const HeaderMap& rhs) const {
   if (size() != rhs.size()) {
     return false;
   }
+  materializeDeferredHeaders();
 
   std::vector<std::pair<absl::string_view, absl::string_view>> rhs_headers;
   rhs_headers.reserve(rhs.size());
@@ -245,6 +246,8 @@ void HeaderMapImpl::insertByKey(HeaderString&& key, HeaderString&& value) {
       value.clear();
     }
   } else {
+    // Keep insertion order with respect to headers that are still deferred.
+    materializeDeferredHeaders();
     addSize(key.size() + value.size());
     HeaderNode i = headers_.insert(std::move(key), std::move(value));
     i->entry_ = i;
@@ -255,6 +258,52 @@ void HeaderMapImpl::addViaMove(HeaderString&& key, HeaderString&& value) {
   insertByKey(std::move(key), std::move(value));
 }
 
+void HeaderMapImpl::addCopyDeferred(absl::string_view key, absl::string_view value) {
+  // O(1) headers are always resolved eagerly so that the inline accessors never need to
+  // materialize the deferred headers. Pseudo headers are kept eager to preserve their ordering.
+  if (staticLookup(key).has_value() || (!key.empty() && key[0] == ':') ||
+      (deferred_headers_ != nullptr && deferred_headers_->materialized_)) {
+    HeaderString new_key;
+    new_key.setCopy(key);
+    HeaderString new_value;
+    new_value.setCopy(value);
+    insertByKey(std::move(new_key), std::move(new_value));
+    return;
+  }
+
+  ASSERT(validHeaderString(key) && validHeaderString(value));
+  if (deferred_headers_ == nullptr) {
+    deferred_headers_ = std::make_unique<DeferredHeaders>();
+  }
+  DeferredHeaders& deferred = *deferred_headers_;
+  deferred.entries_.push_back({static_cast<uint32_t>(deferred.buffer_.size()),
+                               static_cast<uint32_t>(key.size()),
+                               static_cast<uint32_t>(value.size())});
+  deferred.buffer_.append(key);
+  deferred.buffer_.append(value);
+  addSize(key.size() + value.size());
+}
+
+void HeaderMapImpl::materializeDeferredHeadersSlow() {
+  DeferredHeaders& deferred = *deferred_headers_;
+  ASSERT(!deferred.materialized_);
+  deferred.materialized_ = true;
+  const absl::string_view buffer = deferred.buffer_;
+  for (const DeferredHeaders::Entry& entry : deferred.entries_) {
+    // The entries own copies of their key and value. Reference strings would be passed to the
+    // codecs without copying and could outlive the buffer, e.g. when the map is destroyed before
+    // an HTTP/2 frame is serialized.
+    HeaderString key;
+    key.setCopy(buffer.substr(entry.offset_, entry.key_size_));
+    HeaderString value;
+    value.setCopy(buffer.substr(entry.offset_ + entry.key_size_, entry.value_size_));
+    HeaderNode i = headers_.insert(std::move(key), std::move(value));
+    i->entry_ = i;
+  }
+  deferred.entries_ = {};
+  deferred.buffer_ = {};
+}
+
 void HeaderMapImpl::addReference(const LowerCaseString& key, absl::string_view value) {
   HeaderString ref_key(key);
   HeaderString ref_value(value);
@@ -331,6 +380,7 @@ void HeaderMapImpl::setCopy(const LowerCaseString& key, absl::string_view value)
 uint64_t HeaderMapImpl::byteSize() const { return cached_byte_size_; }
 
 void HeaderMapImpl::verifyByteSizeInternalForTest() const {
+  materializeDeferredHeaders();
   // Computes the total byte size by summing the byte size of the keys and values.
   uint64_t byte_size = 0;
   for (const HeaderEntryImpl& header : headers_) {
@@ -358,6 +408,7 @@ HeaderMap::NonConstGetResult HeaderMapImpl::getExisting(absl::string_view key) {
     return ret;
   }
 
+  materializeDeferredHeaders();
   // If the requested header is not an O(1) header try using the lazy map to
   // search for it instead of iterating the headers list.
   if (headers_.maybeMakeMap()) {
@@ -386,6 +437,7 @@ HeaderMap::NonConstGetResult HeaderMapImpl::getExisting(absl::string_view key) {
 }
 
 void HeaderMapImpl::iterate(HeaderMap::ConstIterateCb cb) const {
+  materializeDeferredHeaders();
   for (const HeaderEntryImpl& header : headers_) {
     if (cb(header) == HeaderMap::Iterate::Break) {
       break;
@@ -394,6 +446,7 @@ void HeaderMapImpl::iterate(HeaderMap::ConstIterateCb cb) const {
 }
 
 void HeaderMapImpl::iterateReverse(HeaderMap::ConstIterateCb cb) const {
+  materializeDeferredHeaders();
   for (auto it = headers_.rbegin(); it != headers_.rend(); it++) {
     if (cb(*it) == HeaderMap::Iterate::Break) {
       break;
@@ -401,13 +454,41 @@ void HeaderMapImpl::iterateReverse(HeaderMap::ConstIterateCb cb) const {
   }
 }
 
+bool HeaderMapImpl::iterateForEncoding(HeaderMap::ConstKeyValueIterateCb cb) const {
+  for (const HeaderEntryImpl& header : headers_) {
+    if (cb(header.key(), header.value()) == HeaderMap::Iterate::Break) {
+      return false;
+    }
+  }
+  if (deferredHeadersCount() == 0) {
+    return false;
+  }
+  // Deferred headers are passed as copies rather than references into the buffer they were decoded
+  // into, as encoders may hold on to reference strings until the frame is serialized, which can be
+  // after the map has been materialized or destroyed. The map does not consider itself modified,
+  // so they stay deferred.
+  const absl::string_view buffer = deferred_headers_->buffer_;
+  for (const DeferredHeaders::Entry& entry : deferred_headers_->entries_) {
+    HeaderString key;
+    key.setCopy(buffer.substr(entry.offset_, entry.key_size_));
+    HeaderString value;
+    value.setCopy(buffer.substr(entry.offset_ + entry.key_size_, entry.value_size_));
+    if (cb(key, value) == HeaderMap::Iterate::Break) {
+      break;
+    }
+  }
+  return true;
+}
+
 void HeaderMapImpl::clear() {
   clearInline();
   headers_.clear();
+  deferred_headers_.reset();
   cached_byte_size_ = 0;
 }
 
 size_t HeaderMapImpl::removeIf(const HeaderMap::HeaderMatchPredicate& predicate) {
+  materializeDeferredHeaders();
   const size_t old_size = headers_.size();
   headers_.removeIf([&predicate, this](const HeaderEntryImpl& entry) {
     const bool to_remove = predicate(entry);
@@ -440,12 +521,19 @@ size_t HeaderMapImpl::removePrefix(const LowerCaseString& prefix) {
 }
 
 void HeaderMapImpl::dumpState(std::ostream& os, int indent_level) const {
-  iterate([&os,
-           spaces = spacesForLevel(indent_level)](const HeaderEntry& header) -> HeaderMap::Iterate {
+  // This may be called while dumping state on a crash, so deferred headers are not materialized.
+  const char* spaces = spacesForLevel(indent_level);
+  for (const HeaderEntryImpl& header : headers_) {
     os << spaces << "'" << header.key().getStringView() << "', '" << header.value().getStringView()
        << "'\n";
-    return HeaderMap::Iterate::Continue;
-  });
+  }
+  if (deferred_headers_ != nullptr) {
+    const absl::string_view buffer = deferred_headers_->buffer_;
+    for (const DeferredHeaders::Entry& entry : deferred_headers_->entries_) {
+      os << spaces << "'" << buffer.substr(entry.offset_, entry.key_size_) << "', '"
+         << buffer.substr(entry.offset_ + entry.key_size_, entry.value_size_) << "'\n";
+    }
+  }
 }
 
 HeaderMapImpl::HeaderEntryImpl& HeaderMapImpl::maybeCreateInline(HeaderEntryImpl** entry,
@@ -477,13 +565,13 @@ HeaderMapImpl::HeaderEntryImpl& HeaderMapImpl::maybeCreateInline(HeaderEntryImpl
 }
 
 size_t HeaderMapImpl::removeExisting(absl::string_view key) {
-  const size_t old_size = headers_.size();
   auto lookup = staticLookup(key);
   if (lookup.has_value()) {
-    removeInline(lookup.value().entry_);
-  } else {
-    subtractSize(headers_.remove(key));
+    return removeInline(lookup.value().entry_);
   }
+  materializeDeferredHeaders();
+  const size_t old_size = headers_.size();
+  subtractSize(headers_.remove(key));
   return old_size - headers_.size();
 }
 
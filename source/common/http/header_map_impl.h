@@ -6,6 +6,7 @@
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "envoy/common/optref.h"
 #include "envoy/config/core/v3/base.pb.h"
@@ -85,6 +86,7 @@ public:
   bool operator==(const HeaderMap& rhs) const;
   bool operator!=(const HeaderMap& rhs) const;
   void addViaMove(HeaderString&& key, HeaderString&& value);
+  void addCopyDeferred(absl::string_view key, absl::string_view value);
   void addReference(const LowerCaseString& key, absl::string_view value);
   void addReferenceKey(const LowerCaseString& key, uint64_t value);
   void addReferenceKey(const LowerCaseString& key, absl::string_view value);
@@ -100,12 +102,13 @@ public:
   HeaderMap::GetResult get(const LowerCaseString& key) const;
   void iterate(HeaderMap::ConstIterateCb cb) const;
   void iterateReverse(HeaderMap::ConstIterateCb cb) const;
+  bool iterateForEncoding(HeaderMap::ConstKeyValueIterateCb cb) const;
   void clear();
   size_t remove(const LowerCaseString& key);
   size_t removeIf(const HeaderMap::HeaderMatchPredicate& predicate);
   size_t removePrefix(const LowerCaseString& key);
-  size_t size() const { return headers_.size(); }
-  bool empty() const { return headers_.empty(); }
+  size_t size() const { return headers_.size() + deferredHeadersCount(); }
+  bool empty() const { return headers_.empty() && deferredHeadersCount() == 0; }
   void dumpState(std::ostream& os, int indent_level = 0) const;
   StatefulHeaderKeyFormatterOptConstRef formatter() const {
     return StatefulHeaderKeyFormatterOptConstRef(makeOptRefFromPtr(formatter_.get()));
@@ -321,6 +324,34 @@ protected:
     HeaderLazyMap lazy_map_;
   };
 
+  /**
+   * Non inline headers added with addCopyDeferred() whose entries have not been created yet. Keys
+   * and values are stored back to back in a single buffer. Once materialized, the entries in
+   * headers_ own copies of their keys and values and the buffer is released.
+   */
+  struct DeferredHeaders {
+    struct Entry {
+      uint32_t offset_;
+      uint32_t key_size_;
+      uint32_t value_size_;
+    };
+
+    std::string buffer_;
+    std::vector<Entry> entries_;
+    bool materialized_{};
+  };
+
+  size_t deferredHeadersCount() const {
+    return deferred_headers_ != nullptr ? deferred_headers_->entries_.size() : 0;
+  }
+  // Creates the entries of all deferred headers at the end of headers_. This must be called before
+  // headers_ is read or non inline headers are added or removed.
+  void materializeDeferredHeaders() const {
+    if (deferredHeadersCount() != 0) {
+      const_cast<HeaderMapImpl*>(this)->materializeDeferredHeadersSlow();
+    }
+  }
+  void materializeDeferredHeadersSlow();
   void insertByKey(HeaderString&& key, HeaderString&& value);
   static uint64_t appendToHeader(HeaderString& header, absl::string_view data,
                                  absl::string_view delimiter = ",");
@@ -339,6 +370,7 @@ protected:
   virtual void clearInline() PURE;
   virtual HeaderEntryImpl** inlineHeaders() PURE;
 
+  std::unique_ptr<DeferredHeaders> deferred_headers_;
   HeaderList headers_;
   // TODO(mattklein123): The formatter does not currently get copied when a header map gets
   // copied. This may be problematic in certain cases like request shadowing. This is omitted
@@ -376,6 +408,9 @@ public:
   void addViaMove(HeaderString&& key, HeaderString&& value) override {
     HeaderMapImpl::addViaMove(std::move(key), std::move(value));
   }
+  void addCopyDeferred(absl::string_view key, absl::string_view value) override {
+    HeaderMapImpl::addCopyDeferred(key, value);
+  }
   void addReference(const LowerCaseString& key, absl::string_view value) override {
     HeaderMapImpl::addReference(key, value);
   }
@@ -413,6 +448,9 @@ public:
   void iterateReverse(HeaderMap::ConstIterateCb cb) const override {
     HeaderMapImpl::iterateReverse(cb);
   }
+  bool iterateForEncoding(HeaderMap::ConstKeyValueIterateCb cb) const override {
+    return HeaderMapImpl::iterateForEncoding(cb);
+  }
   void clear() override { HeaderMapImpl::clear(); }
   size_t remove(const LowerCaseString& key) override { return HeaderMapImpl::remove(key); }
   size_t removeIf(const HeaderMap::HeaderMatchPredicate& predicate) override {
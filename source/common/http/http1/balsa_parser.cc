@@ -6,6 +6,7 @@
 
 #include "source/common/common/assert.h"
 #include "source/common/http/headers.h"
+#include "source/common/http/http1/header_scanner.h"
 #include "source/common/runtime/runtime_features.h"
 
 #include "absl/strings/ascii.h"
@@ -25,8 +26,7 @@ constexpr absl::string_view kColonSlashSlash = "://";
 constexpr char kResponseFirstByte = 'H';
 constexpr absl::string_view kHttpVersionPrefix = "HTTP/";
 
-// Allowed characters for field names according to Section 5.1
-// and for methods according to Section 9.1 of RFC 9110:
+// Allowed characters for methods according to Section 9.1 of RFC 9110:
 // https://www.rfc-editor.org/rfc/rfc9110.html
 constexpr absl::string_view kValidCharacters =
     "!#$%&'*+-.0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ^_`abcdefghijklmnopqrstuvwxyz|~";
@@ -139,12 +139,6 @@ bool isVersionValid(absl::string_view version_input) {
          version_input[1] == '.' && absl::ascii_isdigit(version_input[2]);
 }
 
-bool isHeaderNameValid(absl::string_view name) {
-  return std::all_of(name.begin(), name.end(), [](absl::string_view::value_type c) {
-    return std::binary_search(kValidCharactersBegin, kValidCharactersEnd, c);
-  });
-}
-
 } // anonymous namespace
 
 BalsaParser::BalsaParser(MessageType type, ParserCallbacks* connection, size_t max_header_length,
@@ -419,7 +413,7 @@ void BalsaParser::validateAndProcessHeadersOrTrailersImpl(const quiche::BalsaHea
       return;
     }
 
-    if (!isHeaderNameValid(key)) {
+    if (!HeaderScanner::isValidFieldName(key)) {
       status_ = ParserStatus::Error;
       error_message_ = "HPE_INVALID_HEADER_TOKEN";
       return;
@@ -436,7 +430,7 @@ void BalsaParser::validateAndProcessHeadersOrTrailersImpl(const quiche::BalsaHea
 
     // Remove CR and LF characters to match http-parser behavior.
     auto is_cr_or_lf = [](char c) { return c == '\r' || c == '\n'; };
-    if (std::any_of(value.begin(), value.end(), is_cr_or_lf)) {
+    if (HeaderScanner::findCrOrLf(value) != absl::string_view::npos) {
       std::string value_without_cr_or_lf;
       value_without_cr_or_lf.reserve(value.size());
       for (char c : value) {
@@ -22,6 +22,7 @@
 #include "source/common/http/headers.h"
 #include "source/common/http/http1/balsa_parser.h"
 #include "source/common/http/http1/header_formatter.h"
+#include "source/common/http/http1/header_scanner.h"
 #include "source/common/http/http1/legacy_parser_impl.h"
 #include "source/common/http/utility.h"
 #include "source/common/runtime/runtime_features.h"
@@ -815,7 +816,7 @@ Status ConnectionImpl::onHeaderValueImpl(const char* data, size_t length) {
   }
 
   absl::string_view header_value{data, length};
-  if (!Http::HeaderUtility::headerValueIsValid(header_value)) {
+  if (!HeaderScanner::isValidFieldValue(header_value)) {
     ENVOY_CONN_LOG(debug, "invalid header value: {}", connection_, header_value);
     error_code_ = Http::Code::BadRequest;
     RETURN_IF_ERROR(sendProtocolError(Http1ResponseCodeDetails::get().InvalidCharacters));
@@ -0,0 +1,192 @@
+#include "source/common/http/http1/header_scanner.h"
+
+#include <atomic>
+#include <cstdint>
+
+#include "source/common/http/character_set_validation.h"
+
+#include "absl/numeric/bits.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define ENVOY_HTTP1_HEADER_SCANNER_SSE2 1
+#endif
+
+namespace Envoy {
+namespace Http {
+namespace Http1 {
+namespace {
+
+constexpr size_t kVectorSize = 16;
+
+std::atomic<HeaderScanner::Implementation> selected_implementation{
+#ifdef ENVOY_HTTP1_HEADER_SCANNER_SSE2
+    HeaderScanner::Implementation::Sse2
+#else
+    HeaderScanner::Implementation::Scalar
+#endif
+};
+
+bool useSse2() {
+  return selected_implementation.load(std::memory_order_relaxed) ==
+         HeaderScanner::Implementation::Sse2;
+}
+
+bool isValidFieldValueChar(char c) {
+  const uint8_t uc = static_cast<uint8_t>(c);
+  return (uc >= 0x20 && uc != 0x7f) || uc == '\t';
+}
+
+bool isValidFieldNameScalar(absl::string_view name) {
+  for (const char c : name) {
+    if (!testCharInTable(kGenericHeaderNameCharTable, c)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool isValidFieldValueScalar(absl::string_view value) {
+  for (const char c : value) {
+    if (!isValidFieldValueChar(c)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t findCrOrLfScalar(absl::string_view data) {
+  for (size_t i = 0; i < data.size(); ++i) {
+    if (data[i] == '\r' || data[i] == '\n') {
+      return i;
+    }
+  }
+  return absl::string_view::npos;
+}
+
+#ifdef ENVOY_HTTP1_HEADER_SCANNER_SSE2
+
+__m128i load(const char* data) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)); }
+
+// Lanes set to 0xff where lo <= byte <= hi, comparing bytes as unsigned.
+__m128i inRange(__m128i v, char lo, char hi) {
+  const __m128i shifted = _mm_sub_epi8(v, _mm_set1_epi8(lo));
+  return _mm_cmpeq_epi8(_mm_min_epu8(shifted, _mm_set1_epi8(hi - lo)), shifted);
+}
+
+__m128i equals(__m128i v, char c) { return _mm_cmpeq_epi8(v, _mm_set1_epi8(c)); }
+
+bool isValidFieldNameSse2(absl::string_view name) {
+  const char* data = name.data();
+  size_t remaining = name.size();
+  while (remaining >= kVectorSize) {
+    const __m128i v = load(data);
+    // tchar = "!" / "#" / "$" / "%" / "&" / "'" / "*" / "+" / "-" / "." / "^" / "_" / "`" / "|" /
+    //         "~" / DIGIT / ALPHA
+    // The punctuation between '!' and '.' is covered by one range minus the four characters in it
+    // that are not allowed.
+    __m128i punctuation = inRange(v, '!', '.');
+    punctuation = _mm_andnot_si128(
+        _mm_or_si128(_mm_or_si128(equals(v, '"'), equals(v, '(')),
+                     _mm_or_si128(equals(v, ')'), equals(v, ','))),
+        punctuation);
+    const __m128i alnum = _mm_or_si128(inRange(v, '0', '9'),
+                                       _mm_or_si128(inRange(v, 'A', 'Z'), inRange(v, 'a', 'z')));
+    const __m128i other = _mm_or_si128(inRange(v, '^', '`'),
+                                       _mm_or_si128(equals(v, '|'), equals(v, '~')));
+    const __m128i valid = _mm_or_si128(punctuation, _mm_or_si128(alnum, other));
+    if (_mm_movemask_epi8(valid) != 0xffff) {
+      return false;
+    }
+    data += kVectorSize;
+    remaining -= kVectorSize;
+  }
+  return isValidFieldNameScalar({data, remaining});
+}
+
+bool isValidFieldValueSse2(absl::string_view value) {
+  const char* data = value.data();
+  size_t remaining = value.size();
+  while (remaining >= kVectorSize) {
+    const __m128i v = load(data);
+    // Control characters other than horizontal tab, and DEL, are not allowed. Everything else,
+    // including obs-text, is.
+    const __m128i control = _mm_andnot_si128(equals(v, '\t'), inRange(v, 0x00, 0x1f));
+    const __m128i invalid = _mm_or_si128(control, equals(v, 0x7f));
+    if (_mm_movemask_epi8(invalid) != 0) {
+      return false;
+    }
+    data += kVectorSize;
+    remaining -= kVectorSize;
+  }
+  return isValidFieldValueScalar({data, remaining});
+}
+
+size_t findCrOrLfSse2(absl::string_view data) {
+  size_t offset = 0;
+  while (data.size() - offset >= kVectorSize) {
+    const __m128i v = load(data.data() + offset);
+    const uint32_t mask =
+        static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(equals(v, '\r'), equals(v, '\n'))));
+    if (mask != 0) {
+      return offset + absl::countr_zero(mask);
+    }
+    offset += kVectorSize;
+  }
+  const size_t tail = findCrOrLfScalar(data.substr(offset));
+  return tail == absl::string_view::npos ? tail : offset + tail;
+}
+
+#endif
+
+} // namespace
+
+bool HeaderScanner::isValidFieldName(absl::string_view name) {
+#ifdef ENVOY_HTTP1_HEADER_SCANNER_SSE2
+  if (useSse2()) {
+    return isValidFieldNameSse2(name);
+  }
+#endif
+  return isValidFieldNameScalar(name);
+}
+
+bool HeaderScanner::isValidFieldValue(absl::string_view value) {
+#ifdef ENVOY_HTTP1_HEADER_SCANNER_SSE2
+  if (useSse2()) {
+    return isValidFieldValueSse2(value);
+  }
+#endif
+  return isValidFieldValueScalar(value);
+}
+
+size_t HeaderScanner::findCrOrLf(absl::string_view data) {
+#ifdef ENVOY_HTTP1_HEADER_SCANNER_SSE2
+  if (useSse2()) {
+    return findCrOrLfSse2(data);
+  }
+#endif
+  return findCrOrLfScalar(data);
+}
+
+void HeaderScanner::setImplementation(Implementation implementation) {
+  if (!sse2Available()) {
+    implementation = Implementation::Scalar;
+  }
+  selected_implementation.store(implementation, std::memory_order_relaxed);
+}
+
+HeaderScanner::Implementation HeaderScanner::implementation() {
+  return selected_implementation.load(std::memory_order_relaxed);
+}
+
+bool HeaderScanner::sse2Available() {
+#ifdef ENVOY_HTTP1_HEADER_SCANNER_SSE2
+  return true;
+#else
+  return false;
+#endif
+}
+
+} // namespace Http1
+} // namespace Http
+} // namespace Envoy
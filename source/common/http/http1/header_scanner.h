@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+
+#include "absl/strings/string_view.h"
+
+namespace Envoy {
+namespace Http {
+namespace Http1 {
+
+/**
+ * Byte scanning primitives used while processing parsed HTTP/1 header fields. Each primitive has a
+ * portable scalar implementation and, when built for a target with SSE2, a vectorized
+ * implementation that examines 16 bytes per step. The vectorized implementation is used by default
+ * when available; the implementation can be switched at runtime, which is mostly useful for
+ * differential testing and benchmarking.
+ */
+class HeaderScanner {
+public:
+  enum class Implementation { Scalar, Sse2 };
+
+  /**
+   * @return true if every character of the name is a token character (RFC 9110 section 5.1).
+   */
+  static bool isValidFieldName(absl::string_view name);
+
+  /**
+   * @return true if the value contains only characters allowed in a field value: visible ASCII,
+   *         space, horizontal tab and obs-text. This matches HeaderUtility::headerValueIsValid().
+   */
+  static bool isValidFieldValue(absl::string_view value);
+
+  /**
+   * @return the offset of the first CR or LF character in data, or absl::string_view::npos if
+   *         there is none.
+   */
+  static size_t findCrOrLf(absl::string_view data);
+
+  /**
+   * Select the implementation used by all threads.
+   * @param implementation the implementation to use. Selecting Sse2 on a target without SSE2 falls
+   *        back to Scalar.
+   */
+  static void setImplementation(Implementation implementation);
+
+  /**
+   * @return the implementation currently in use.
+   */
+  static Implementation implementation();
+
+  /**
+   * @return true if this build includes the SSE2 implementation.
+   */
+  static bool sse2Available();
+};
+
+} // namespace Http1
+} // namespace Http
+} // namespace Envoy
@@ -244,10 +244,14 @@ std::vector<http2::adapter::Header>
 ConnectionImpl::StreamImpl::buildHeaders(const HeaderMap& headers) {
   std::vector<http2::adapter::Header> out;
   out.reserve(headers.size());
-  headers.iterate([&out](const HeaderEntry& header) -> HeaderMap::Iterate {
-    out.push_back({getRep(header.key()), getRep(header.value())});
-    return HeaderMap::Iterate::Continue;
-  });
+  const bool encoded_deferred_headers = headers.iterateForEncoding(
+      [&out](const HeaderString& key, const HeaderString& value) -> HeaderMap::Iterate {
+        out.push_back({getRep(key), getRep(value)});
+        return HeaderMap::Iterate::Continue;
+      });
+  if (encoded_deferred_headers) {
+    parent_.stats_.deferred_headers_encoded_.inc();
+  }
   return out;
 }
 
@@ -642,7 +646,12 @@ void ConnectionImpl::StreamImpl::pendingSendBufferLowWatermark() {
 }
 
 void ConnectionImpl::StreamImpl::saveHeader(HeaderString&& name, HeaderString&& value) {
-  if (!Utility::reconstituteCrumbledCookies(name, value, cookies_)) {
+  if (Utility::reconstituteCrumbledCookies(name, value, cookies_)) {
+    return;
+  }
+  if (parent_.defer_header_materialization_) {
+    headers().addCopyDeferred(name.getStringView(), value.getStringView());
+  } else {
     headers().addViaMove(std::move(name), std::move(value));
   }
 }
@@ -864,6 +873,8 @@ ConnectionImpl::ConnectionImpl(Network::Connection& connection, CodecStats& stat
       per_stream_buffer_limit_(http2_options.initial_stream_window_size().value()),
       stream_error_on_invalid_http_messaging_(
           http2_options.override_stream_error_on_invalid_http_message().value()),
+      defer_header_materialization_(Runtime::runtimeFeatureEnabled(
+          "envoy.reloadable_features.defer_decoded_header_materialization")),
       protocol_constraints_(stats, http2_options), dispatching_(false), raised_goaway_(false),
       random_(random_generator),
       last_received_data_time_(connection_.dispatcher().timeSource().monotonicTime()) {
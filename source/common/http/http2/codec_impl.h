@@ -308,7 +308,7 @@ protected:
 
     StreamImpl* base() { return this; }
     void resetStreamWorker(StreamResetReason reason);
-    static std::vector<http2::adapter::Header> buildHeaders(const HeaderMap& headers);
+    std::vector<http2::adapter::Header> buildHeaders(const HeaderMap& headers);
     virtual Status onBeginHeaders() PURE;
     virtual void advanceHeadersState() PURE;
     virtual HeadersState headersState() const PURE;
@@ -721,6 +721,8 @@ protected:
   bool allow_metadata_;
   uint64_t max_metadata_size_;
   const bool stream_error_on_invalid_http_messaging_;
+  // Whether decoded headers that are not O(1) headers are added with addCopyDeferred().
+  const bool defer_header_materialization_;
 
   // Status for any errors encountered by the nghttp2 callbacks.
   // nghttp2 library uses single return code to indicate callback failure and
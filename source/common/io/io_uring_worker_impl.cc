@@ -60,14 +60,18 @@ void IoUringSocketEntry::onRemoteClose() {
 
 IoUringWorkerImpl::IoUringWorkerImpl(uint32_t io_uring_size, bool use_submission_queue_polling,
                                      uint32_t read_buffer_size, uint32_t write_timeout_ms,
-                                     Event::Dispatcher& dispatcher)
+                                     Event::Dispatcher& dispatcher, bool enable_batch_submission)
     : IoUringWorkerImpl(std::make_unique<IoUringImpl>(io_uring_size, use_submission_queue_polling),
-                        read_buffer_size, write_timeout_ms, dispatcher) {}
+                        read_buffer_size, write_timeout_ms, dispatcher, enable_batch_submission) {}
 
 IoUringWorkerImpl::IoUringWorkerImpl(IoUringPtr&& io_uring, uint32_t read_buffer_size,
-                                     uint32_t write_timeout_ms, Event::Dispatcher& dispatcher)
+                                     uint32_t write_timeout_ms, Event::Dispatcher& dispatcher,
+                                     bool enable_batch_submission)
     : io_uring_(std::move(io_uring)), read_buffer_size_(read_buffer_size),
       write_timeout_ms_(write_timeout_ms), dispatcher_(dispatcher) {
+  if (enable_batch_submission) {
+    submit_cb_ = dispatcher_.createSchedulableCallback([this]() { io_uring_->submit(); });
+  }
   const os_fd_t event_fd = io_uring_->registerEventfd();
   // We only care about the read event of Eventfd, since we only receive the
   // event here.
@@ -94,6 +98,11 @@ IoUringWorkerImpl::~IoUringWorkerImpl() {
     for (auto& socket : sockets_) {
       ENVOY_LOG(trace, "the socket fd = {} not closed", socket->fd());
     }
+    // With batch submission the requests are submitted at the end of the event loop iteration,
+    // which never comes while the worker is being destroyed, so submit them here.
+    if (submit_cb_ != nullptr) {
+      flushSubmissions();
+    }
     onFileEvent();
   }
 
@@ -144,7 +153,7 @@ IoUringWorkerImpl::submitConnectRequest(IoUringSocket& socket,
   auto res = io_uring_->prepareConnect(socket.fd(), address, req);
   if (res == IoUringResult::Failed) {
     // TODO(rojkov): handle `EBUSY` in case the completion queue is never reaped.
-    submit();
+    flushSubmissions();
     res = io_uring_->prepareConnect(socket.fd(), address, req);
     RELEASE_ASSERT(res == IoUringResult::Ok, "unable to prepare connect");
   }
@@ -160,7 +169,7 @@ Request* IoUringWorkerImpl::submitReadRequest(IoUringSocket& socket) {
   auto res = io_uring_->prepareReadv(socket.fd(), req->iov_.get(), 1, 0, req);
   if (res == IoUringResult::Failed) {
     // TODO(rojkov): handle `EBUSY` in case the completion queue is never reaped.
-    submit();
+    flushSubmissions();
     res = io_uring_->prepareReadv(socket.fd(), req->iov_.get(), 1, 0, req);
     RELEASE_ASSERT(res == IoUringResult::Ok, "unable to prepare readv");
   }
@@ -177,7 +186,7 @@ Request* IoUringWorkerImpl::submitWriteRequest(IoUringSocket& socket,
   auto res = io_uring_->prepareWritev(socket.fd(), req->iov_.get(), slices.size(), 0, req);
   if (res == IoUringResult::Failed) {
     // TODO(rojkov): handle `EBUSY` in case the completion queue is never reaped.
-    submit();
+    flushSubmissions();
     res = io_uring_->prepareWritev(socket.fd(), req->iov_.get(), slices.size(), 0, req);
     RELEASE_ASSERT(res == IoUringResult::Ok, "unable to prepare writev");
   }
@@ -193,7 +202,7 @@ Request* IoUringWorkerImpl::submitCloseRequest(IoUringSocket& socket) {
   auto res = io_uring_->prepareClose(socket.fd(), req);
   if (res == IoUringResult::Failed) {
     // TODO(rojkov): handle `EBUSY` in case the completion queue is never reaped.
-    submit();
+    flushSubmissions();
     res = io_uring_->prepareClose(socket.fd(), req);
     RELEASE_ASSERT(res == IoUringResult::Ok, "unable to prepare close");
   }
@@ -210,7 +219,7 @@ Request* IoUringWorkerImpl::submitCancelRequest(IoUringSocket& socket, Request*
   auto res = io_uring_->prepareCancel(request_to_cancel, req);
   if (res == IoUringResult::Failed) {
     // TODO(rojkov): handle `EBUSY` in case the completion queue is never reaped.
-    submit();
+    flushSubmissions();
     res = io_uring_->prepareCancel(request_to_cancel, req);
     RELEASE_ASSERT(res == IoUringResult::Ok, "unable to prepare cancel");
   }
@@ -227,7 +236,7 @@ Request* IoUringWorkerImpl::submitShutdownRequest(IoUringSocket& socket, int how
   auto res = io_uring_->prepareShutdown(socket.fd(), how, req);
   if (res == IoUringResult::Failed) {
     // TODO(rojkov): handle `EBUSY` in case the completion queue is never reaped.
-    submit();
+    flushSubmissions();
     res = io_uring_->prepareShutdown(socket.fd(), how, req);
     RELEASE_ASSERT(res == IoUringResult::Ok, "unable to prepare cancel");
   }
@@ -301,9 +310,24 @@ void IoUringWorkerImpl::onFileEvent() {
 }
 
 void IoUringWorkerImpl::submit() {
-  if (!delay_submit_) {
+  if (delay_submit_) {
+    return;
+  }
+  if (submit_cb_ == nullptr) {
     io_uring_->submit();
+  } else if (!submit_cb_->enabled()) {
+    submit_cb_->scheduleCallbackCurrentIteration();
+  }
+}
+
+void IoUringWorkerImpl::flushSubmissions() {
+  if (delay_submit_) {
+    return;
+  }
+  if (submit_cb_ != nullptr) {
+    submit_cb_->cancel();
   }
+  io_uring_->submit();
 }
 
 IoUringServerSocket::IoUringServerSocket(os_fd_t fd, IoUringWorkerImpl& parent,
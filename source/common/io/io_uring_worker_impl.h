@@ -32,9 +32,9 @@ class IoUringWorkerImpl : public IoUringWorker, private Logger::Loggable<Logger:
 public:
   IoUringWorkerImpl(uint32_t io_uring_size, bool use_submission_queue_polling,
                     uint32_t read_buffer_size, uint32_t write_timeout_ms,
-                    Event::Dispatcher& dispatcher);
+                    Event::Dispatcher& dispatcher, bool enable_batch_submission = false);
   IoUringWorkerImpl(IoUringPtr&& io_uring, uint32_t read_buffer_size, uint32_t write_timeout_ms,
-                    Event::Dispatcher& dispatcher);
+                    Event::Dispatcher& dispatcher, bool enable_batch_submission = false);
   ~IoUringWorkerImpl() override;
 
   // IoUringWorker
@@ -69,6 +69,8 @@ protected:
   IoUringSocketEntry& addSocket(IoUringSocketEntryPtr&& socket);
   void onFileEvent();
   void submit();
+  // Submits the pending requests right away, e.g. to free up the submission queue.
+  void flushSubmissions();
 
   // The iouring instance.
   IoUringPtr io_uring_;
@@ -84,6 +86,9 @@ protected:
   // The IoUringWorker will delay the submit the requests which are submitted in request completion
   // callback.
   bool delay_submit_{false};
+  // Only set if batch submission is enabled. Submits all the requests prepared during the current
+  // event loop iteration at its end.
+  Event::SchedulableCallbackPtr submit_cb_;
 };
 
 class IoUringSocketEntry : public IoUringSocket,
@@ -155,6 +155,8 @@ public:
   void setTransportSocketIsReadable() override;
   void flushWriteBuffer() override;
   TransportSocketPtr& transportSocket() { return transport_socket_; }
+  // The number of bytes waiting to be written to the socket.
+  uint64_t bufferedWriteLength() const { return write_buffer_->length(); }
 
   // Obtain global next connection ID. This should only be used in tests.
   static uint64_t nextGlobalIdForTest() { return next_global_id_; }
@@ -15,6 +15,14 @@
 #include "absl/container/fixed_array.h"
 #include "absl/types/optional.h"
 
+#if defined(__linux__)
+#include <linux/errqueue.h>
+
+#if defined(MSG_ZEROCOPY) && defined(SO_ZEROCOPY) && defined(SO_EE_ORIGIN_ZEROCOPY)
+#define ENVOY_ZERO_COPY_SEND_SUPPORTED 1
+#endif
+#endif
+
 using Envoy::Api::SysCallIntResult;
 using Envoy::Api::SysCallSizeResult;
 
@@ -53,6 +61,115 @@ constexpr int messageTruncatedOption() {
 
 namespace Network {
 
+namespace {
+
+// Reads the zero-copy completion notifications from the error queue of `fd` and releases the
+// slices of the completed sends.
+void reapZeroCopyCompletions([[maybe_unused]] os_fd_t fd, [[maybe_unused]] ZeroCopySendStats& stats,
+                             [[maybe_unused]] std::list<ZeroCopySend>& sends) {
+#ifdef ENVOY_ZERO_COPY_SEND_SUPPORTED
+  auto& os_syscalls = Api::OsSysCallsSingleton::get();
+  while (!sends.empty()) {
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(sock_extended_err) + sizeof(sockaddr_in6))];
+    msghdr message{};
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+    // Reading the error queue never blocks. It fails with EAGAIN once it is empty.
+    if (os_syscalls.recvmsg(fd, &message, MSG_ERRQUEUE).return_value_ < 0) {
+      return;
+    }
+
+    bool reaped = false;
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&message); cmsg != nullptr;
+         cmsg = CMSG_NXTHDR(&message, cmsg)) {
+      if (!(cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR) &&
+          !(cmsg->cmsg_level == SOL_IPV6 && cmsg->cmsg_type == IPV6_RECVERR)) {
+        continue;
+      }
+      sock_extended_err error;
+      safeMemcpyUnsafeSrc(&error, CMSG_DATA(cmsg));
+      if (error.ee_errno != 0 || error.ee_origin != SO_EE_ORIGIN_ZEROCOPY) {
+        continue;
+      }
+      // The notification covers the sends numbered from ee_info to ee_data, inclusive.
+      const uint32_t first = error.ee_info;
+      const uint32_t range = error.ee_data - first;
+      if (error.ee_code & SO_EE_CODE_ZEROCOPY_COPIED) {
+        stats.copied_.add(static_cast<uint64_t>(range) + 1);
+      }
+      sends.remove_if([first, range](const ZeroCopySend& send) {
+        return static_cast<uint32_t>(send.id_ - first) <= range;
+      });
+      reaped = true;
+    }
+    if (!reaped) {
+      return;
+    }
+  }
+#endif
+}
+
+// Makes closing the socket reset the connection, which discards the data the peer hasn't
+// acknowledged and with it the kernel's references to the pages of the zero-copy sends in flight.
+void resetOnClose(os_fd_t fd) {
+  const struct linger linger_option = {1, 0};
+  Api::OsSysCallsSingleton::get().setsockopt(fd, SOL_SOCKET, SO_LINGER, &linger_option,
+                                             sizeof(linger_option));
+}
+
+} // namespace
+
+void ClosedZeroCopySockets::add(os_fd_t fd, ZeroCopySendStats& stats,
+                                std::list<ZeroCopySend>&& sends) {
+  sockets_.emplace_front(fd, stats, std::move(sends));
+  auto socket = sockets_.begin();
+  // Completions are reported as error queue readiness, which wakes up read events.
+  socket->file_event_ = dispatcher_.createFileEvent(
+      fd,
+      [this, socket](uint32_t) {
+        onFileEvent(socket);
+        return absl::OkStatus();
+      },
+      Event::PlatformDefaultTriggerType, Event::FileReadyType::Read);
+  socket->close_timer_ = dispatcher_.createTimer([this, socket]() { onCloseTimeout(socket); });
+  socket->close_timer_->enableTimer(close_timeout_);
+}
+
+void ClosedZeroCopySockets::onFileEvent(std::list<ClosedSocket>::iterator socket) {
+  reapZeroCopyCompletions(socket->fd_, socket->stats_, socket->sends_);
+  if (socket->sends_.empty()) {
+    sockets_.erase(socket);
+  }
+}
+
+void ClosedZeroCopySockets::onCloseTimeout(std::list<ClosedSocket>::iterator socket) {
+  socket->stats_.close_timeout_.inc();
+  sockets_.erase(socket);
+}
+
+ClosedZeroCopySockets::ClosedSocket::~ClosedSocket() {
+  // The file event must be removed before its file descriptor is closed.
+  file_event_.reset();
+  if (!sends_.empty()) {
+    // The close timed out, or the thread is shutting down, with sends still in flight.
+    resetOnClose(fd_);
+  }
+  Api::OsSysCallsSingleton::get().close(fd_);
+}
+
+void ZeroCopySendConfig::onWorkerThreadInitialized() {
+  closed_sockets_.set([close_timeout = close_timeout_](Event::Dispatcher& dispatcher) {
+    return std::make_shared<ClosedZeroCopySockets>(dispatcher, close_timeout);
+  });
+}
+
+OptRef<ClosedZeroCopySockets> ZeroCopySendConfig::closedSockets() {
+  if (closed_sockets_.isShutdown() || !closed_sockets_.currentThreadRegistered()) {
+    return {};
+  }
+  return closed_sockets_.get();
+}
+
 IoSocketHandleImpl::~IoSocketHandleImpl() {
   if (SOCKET_VALID(fd_)) {
     IoSocketHandleImpl::close();
@@ -63,8 +180,33 @@ Api::IoCallUint64Result IoSocketHandleImpl::close() {
   if (file_event_) {
     file_event_.reset();
   }
+  if (zero_copy_send_config_ != nullptr) {
+    reapZeroCopyCompletions();
+  }
 
   ASSERT(SOCKET_VALID(fd_));
+  if (!zero_copy_sends_.empty()) {
+    if (!closeResetsConnection()) {
+      OptRef<ClosedZeroCopySockets> closed_sockets = zero_copy_send_config_->closedSockets();
+      if (closed_sockets.has_value()) {
+        // The kernel keeps transmitting, and possibly retransmitting, from the pinned pages of the
+        // sends in flight after the close, so their slices must not be released before their
+        // completions. Send the FIN now, and hand the socket over to be closed once the
+        // completions have been read from its error queue.
+        Api::OsSysCallsSingleton::get().shutdown(fd_, ENVOY_SHUT_WR);
+        closed_sockets->add(fd_, zero_copy_send_config_->stats_, std::move(zero_copy_sends_));
+        zero_copy_sends_.clear();
+        SET_SOCKET_INVALID(fd_);
+        return Api::ioCallUint64ResultNoError();
+      }
+      // There is no dispatcher on this thread to wait for the completions on.
+      resetOnClose(fd_);
+    }
+    // The reset discards the data the peer hasn't acknowledged, and with it the references to the
+    // pinned pages.
+    zero_copy_sends_.clear();
+  }
+
   const int rc = Api::OsSysCallsSingleton::get().close(fd_).return_value_;
   SET_SOCKET_INVALID(fd_);
   return {static_cast<unsigned long>(rc), Api::IoError::none()};
@@ -101,6 +243,10 @@ Api::IoCallUint64Result IoSocketHandleImpl::read(Buffer::Instance& buffer,
   if (max_length == 0) {
     return Api::ioCallUint64ResultNoError();
   }
+  if (!zero_copy_sends_.empty()) {
+    // Zero-copy completion notifications are reported to the file event as readiness.
+    reapZeroCopyCompletions();
+  }
   Buffer::Reservation reservation = buffer.reserveForRead();
   Api::IoCallUint64Result result = readv(std::min(reservation.length(), max_length),
                                          reservation.slices(), reservation.numSlices());
@@ -139,6 +285,16 @@ Api::IoCallUint64Result IoSocketHandleImpl::writev(const Buffer::RawSlice* slice
 Api::IoCallUint64Result IoSocketHandleImpl::write(Buffer::Instance& buffer) {
   constexpr uint64_t MaxSlices = 16;
   Buffer::RawSliceVector slices = buffer.getRawSlices(MaxSlices);
+  if (zero_copy_send_config_ != nullptr) {
+    reapZeroCopyCompletions();
+    auto* owned_buffer = dynamic_cast<Buffer::OwnedImpl*>(&buffer);
+    if (owned_buffer != nullptr) {
+      absl::optional<Api::IoCallUint64Result> result = zeroCopyWrite(*owned_buffer, slices);
+      if (result.has_value()) {
+        return std::move(result.value());
+      }
+    }
+  }
   Api::IoCallUint64Result result = writev(slices.begin(), slices.size());
   if (result.ok() && result.return_value_ > 0) {
     buffer.drain(static_cast<uint64_t>(result.return_value_));
@@ -146,6 +302,75 @@ Api::IoCallUint64Result IoSocketHandleImpl::write(Buffer::Instance& buffer) {
   return result;
 }
 
+bool IoSocketHandleImpl::enableZeroCopySend([[maybe_unused]] ZeroCopySendConfigSharedPtr config) {
+#ifdef ENVOY_ZERO_COPY_SEND_SUPPORTED
+  const int enable = 1;
+  if (setOption(SOL_SOCKET, SO_ZEROCOPY, &enable, sizeof(enable)).return_value_ != 0) {
+    return false;
+  }
+  zero_copy_send_config_ = std::move(config);
+  return true;
+#else
+  return false;
+#endif
+}
+
+absl::optional<Api::IoCallUint64Result>
+IoSocketHandleImpl::zeroCopyWrite([[maybe_unused]] Buffer::OwnedImpl& buffer,
+                                  [[maybe_unused]] const Buffer::RawSliceVector& slices) {
+#ifdef ENVOY_ZERO_COPY_SEND_SUPPORTED
+  absl::FixedArray<iovec> iov(slices.size());
+  uint64_t num_slices_to_write = 0;
+  uint64_t num_bytes_to_write = 0;
+  for (const Buffer::RawSlice& slice : slices) {
+    if (slice.mem_ != nullptr && slice.len_ != 0) {
+      iov[num_slices_to_write].iov_base = slice.mem_;
+      iov[num_slices_to_write].iov_len = slice.len_;
+      num_slices_to_write++;
+      num_bytes_to_write += slice.len_;
+    }
+  }
+  // Pinning pages and processing the completion costs more than copying small writes.
+  if (num_bytes_to_write < zero_copy_send_config_->min_write_size_) {
+    return absl::nullopt;
+  }
+
+  msghdr message{};
+  message.msg_iov = iov.begin();
+  message.msg_iovlen = num_slices_to_write;
+  Api::IoCallUint64Result result = sysCallResultToIoCallResult(
+      Api::OsSysCallsSingleton::get().sendmsg(fd_, &message, MSG_ZEROCOPY));
+  if (!result.ok()) {
+    if (result.err_->getSystemErrorCode() == ENOBUFS) {
+      // The kernel refused to pin more pages for the socket, e.g. because of the optmem limit.
+      zero_copy_send_config_->stats_.fallback_.inc();
+      return absl::nullopt;
+    }
+    return absl::make_optional(std::move(result));
+  }
+
+  zero_copy_send_config_->stats_.sent_.inc();
+  zero_copy_sends_.emplace_back(next_zero_copy_send_id_++);
+  zero_copy_sends_.back().slices_.moveSlices(buffer, result.return_value_);
+  return absl::make_optional(std::move(result));
+#else
+  return absl::nullopt;
+#endif
+}
+
+void IoSocketHandleImpl::reapZeroCopyCompletions() {
+  Network::reapZeroCopyCompletions(fd_, zero_copy_send_config_->stats_, zero_copy_sends_);
+}
+
+bool IoSocketHandleImpl::closeResetsConnection() const {
+  struct linger linger_option {};
+  socklen_t option_length = sizeof(linger_option);
+  return Api::OsSysCallsSingleton::get()
+                 .getsockopt(fd_, SOL_SOCKET, SO_LINGER, &linger_option, &option_length)
+                 .return_value_ == 0 &&
+         linger_option.l_onoff != 0 && linger_option.l_linger == 0;
+}
+
 Api::IoCallUint64Result IoSocketHandleImpl::sendmsg(const Buffer::RawSlice* slices,
                                                     uint64_t num_slice, int flags,
                                                     const Address::Ip* self_ip,
@@ -549,8 +774,12 @@ IoHandlePtr IoSocketHandleImpl::accept(struct sockaddr* addr, socklen_t* addrlen
   if (SOCKET_INVALID(result.return_value_)) {
     return nullptr;
   }
-  return SocketInterfaceImpl::makePlatformSpecificSocket(result.return_value_, socket_v6only_,
-                                                         domain_, {});
+  IoHandlePtr io_handle = SocketInterfaceImpl::makePlatformSpecificSocket(
+      result.return_value_, socket_v6only_, domain_, {});
+  if (zero_copy_send_config_ != nullptr) {
+    static_cast<IoSocketHandleImpl&>(*io_handle).enableZeroCopySend(zero_copy_send_config_);
+  }
+  return io_handle;
 }
 
 Api::SysCallIntResult IoSocketHandleImpl::connect(Address::InstanceConstSharedPtr address) {
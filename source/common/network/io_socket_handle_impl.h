@@ -1,14 +1,24 @@
 #pragma once
 
+#include <chrono>
+#include <list>
 #include <memory>
 #include <vector>
 
 #include "envoy/api/io_error.h"
 #include "envoy/api/os_sys_calls.h"
+#include "envoy/common/optref.h"
 #include "envoy/common/platform.h"
 #include "envoy/event/dispatcher.h"
+#include "envoy/event/file_event.h"
+#include "envoy/event/timer.h"
 #include "envoy/network/io_handle.h"
+#include "envoy/stats/scope.h"
+#include "envoy/stats/stats_macros.h"
+#include "envoy/thread_local/thread_local.h"
+#include "envoy/thread_local/thread_local_object.h"
 
+#include "source/common/buffer/buffer_impl.h"
 #include "source/common/common/logger.h"
 #include "source/common/network/io_socket_error_impl.h"
 #include "source/common/network/io_socket_handle_base_impl.h"
@@ -21,6 +31,102 @@ namespace Network {
 
 using QuicEnvoyAddressPair = std::pair<quic::QuicSocketAddress, Address::InstanceConstSharedPtr>;
 
+/**
+ * All zero-copy send stats. @see stats_macros.h
+ */
+#define ALL_ZERO_COPY_SEND_STATS(COUNTER)                                                          \
+  COUNTER(close_timeout)                                                                           \
+  COUNTER(copied)                                                                                  \
+  COUNTER(fallback)                                                                                \
+  COUNTER(sent)
+
+/**
+ * Struct definition for all zero-copy send stats. @see stats_macros.h
+ */
+struct ZeroCopySendStats {
+  ALL_ZERO_COPY_SEND_STATS(GENERATE_COUNTER_STRUCT)
+};
+
+/**
+ * A write sent with MSG_ZEROCOPY whose slices may still be referenced by the kernel.
+ */
+struct ZeroCopySend {
+  explicit ZeroCopySend(uint32_t id) : id_(id) {}
+
+  // The kernel numbers zero-copy sends on a socket sequentially, starting at 0.
+  const uint32_t id_;
+  Buffer::OwnedImpl slices_;
+};
+
+/**
+ * The sockets of a thread that were closed while some of their zero-copy sends were still in
+ * flight. Each of them is kept open, with a file event that reads the completions from its error
+ * queue, until the last of its sends completes. If that takes longer than the close timeout, the
+ * connection is reset, which discards the data the peer hasn't acknowledged, and the slices of the
+ * remaining sends are released.
+ */
+class ClosedZeroCopySockets : public ThreadLocal::ThreadLocalObject {
+public:
+  ClosedZeroCopySockets(Event::Dispatcher& dispatcher, std::chrono::milliseconds close_timeout)
+      : dispatcher_(dispatcher), close_timeout_(close_timeout) {}
+
+  /**
+   * Takes over a socket whose write side has been shut down.
+   * @param fd supplies the file descriptor, which is closed once the sends have completed.
+   * @param stats supplies the stats of the socket's zero-copy sends.
+   * @param sends supplies the sends in flight.
+   */
+  void add(os_fd_t fd, ZeroCopySendStats& stats, std::list<ZeroCopySend>&& sends);
+
+  size_t size() const { return sockets_.size(); }
+
+private:
+  struct ClosedSocket {
+    ClosedSocket(os_fd_t fd, ZeroCopySendStats& stats, std::list<ZeroCopySend>&& sends)
+        : fd_(fd), stats_(stats), sends_(std::move(sends)) {}
+    ~ClosedSocket();
+
+    const os_fd_t fd_;
+    ZeroCopySendStats& stats_;
+    std::list<ZeroCopySend> sends_;
+    Event::FileEventPtr file_event_;
+    Event::TimerPtr close_timer_;
+  };
+
+  void onFileEvent(std::list<ClosedSocket>::iterator socket);
+  void onCloseTimeout(std::list<ClosedSocket>::iterator socket);
+
+  Event::Dispatcher& dispatcher_;
+  const std::chrono::milliseconds close_timeout_;
+  std::list<ClosedSocket> sockets_;
+};
+
+/**
+ * Configuration shared by all the sockets that send large writes with MSG_ZEROCOPY.
+ */
+struct ZeroCopySendConfig {
+  ZeroCopySendConfig(uint64_t min_write_size, std::chrono::milliseconds close_timeout,
+                     Stats::Scope& scope, ThreadLocal::SlotAllocator& tls)
+      : min_write_size_(min_write_size), close_timeout_(close_timeout),
+        stats_({ALL_ZERO_COPY_SEND_STATS(POOL_COUNTER_PREFIX(scope, "zero_copy_send."))}),
+        closed_sockets_(tls) {}
+
+  // Creates the closed sockets of each thread, once the worker threads have been registered.
+  void onWorkerThreadInitialized();
+  // Returns the closed sockets of the current thread, or an empty reference if the thread has no
+  // dispatcher to wait for completions on.
+  OptRef<ClosedZeroCopySockets> closedSockets();
+
+  // Writes smaller than this are copied into the kernel as usual.
+  const uint64_t min_write_size_;
+  // How long a socket closed with zero-copy sends in flight waits for their completions.
+  const std::chrono::milliseconds close_timeout_;
+  ZeroCopySendStats stats_;
+  ThreadLocal::TypedSlot<ClosedZeroCopySockets> closed_sockets_;
+};
+
+using ZeroCopySendConfigSharedPtr = std::shared_ptr<ZeroCopySendConfig>;
+
 /**
  * IoHandle derivative for sockets.
  */
@@ -79,6 +185,15 @@ public:
 
   Api::SysCallIntResult shutdown(int how) override;
 
+  /**
+   * Send writes of at least `min_write_size_` bytes with MSG_ZEROCOPY. The written slices are kept
+   * alive until the kernel reports, through the socket error queue, that it no longer references
+   * them. Only supported for TCP sockets on Linux.
+   * @param config supplies the shared zero-copy configuration and stats.
+   * @return whether zero-copy sends were enabled on the socket.
+   */
+  bool enableZeroCopySend(ZeroCopySendConfigSharedPtr config);
+
 protected:
   // Converts a SysCallSizeResult to IoCallUint64Result.
   template <typename T>
@@ -116,6 +231,17 @@ private:
   Address::InstanceConstSharedPtr getOrCreateEnvoyAddressInstance(sockaddr_storage ss,
                                                                   socklen_t ss_len);
 
+  // Writes the slices with MSG_ZEROCOPY and moves the written slices out of `buffer`. Returns
+  // absl::nullopt if the write should be copied into the kernel instead.
+  absl::optional<Api::IoCallUint64Result> zeroCopyWrite(Buffer::OwnedImpl& buffer,
+                                                        const Buffer::RawSliceVector& slices);
+  // Reads the zero-copy completion notifications from the socket error queue and releases the
+  // slices of the completed sends.
+  void reapZeroCopyCompletions();
+  // Returns true if closing the socket resets the connection, i.e. SO_LINGER is set with a zero
+  // timeout, which discards the data the peer hasn't acknowledged.
+  bool closeResetsConnection() const;
+
   // Caches the address instances of the most recently received packets on this socket.
   // Should only be used by QUIC client sockets to avoid creating multiple address instances for
   // the same address in each read operation. Since the QUIC client sockets are connected via a
@@ -125,6 +251,11 @@ private:
   // Only non-null if address_cache_max_capacity_ is greater than 0.
   absl::optional<std::vector<QuicEnvoyAddressPair>> recent_received_addresses_ = absl::nullopt;
 
+  // Only non-null if zero-copy sends are enabled on the socket.
+  ZeroCopySendConfigSharedPtr zero_copy_send_config_;
+  std::list<ZeroCopySend> zero_copy_sends_;
+  uint32_t next_zero_copy_send_id_{0};
+
   // For testing and benchmarking non-public methods.
   friend class IoSocketHandleImplTestWrapper;
 };
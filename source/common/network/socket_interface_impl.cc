@@ -10,6 +10,7 @@
 #include "source/common/network/address_impl.h"
 #include "source/common/network/io_socket_handle_impl.h"
 #include "source/common/network/win32_socket_handle_impl.h"
+#include "source/common/protobuf/utility.h"
 
 #if defined(__linux__) && !defined(__ANDROID_API__) && defined(ENVOY_ENABLE_IO_URING)
 #include "source/common/io/io_uring_worker_factory_impl.h"
@@ -31,6 +32,9 @@ void DefaultSocketInterfaceExtension::onWorkerThreadInitialized() {
   if (io_uring_worker_factory_ != nullptr) {
     io_uring_worker_factory_->onWorkerThreadInitialized();
   }
+  if (zero_copy_send_config_ != nullptr) {
+    zero_copy_send_config_->onWorkerThreadInitialized();
+  }
 }
 
 IoHandlePtr SocketInterfaceImpl::makePlatformSpecificSocket(
@@ -59,8 +63,17 @@ IoHandlePtr SocketInterfaceImpl::makeSocket(int socket_fd, bool socket_v6only,
   if (socket_type == Socket::Type::Datagram) {
     return makePlatformSpecificSocket(socket_fd, socket_v6only, domain, options, nullptr);
   }
-  return makePlatformSpecificSocket(socket_fd, socket_v6only, domain, options,
-                                    io_uring_worker_factory_.lock().get());
+  IoHandlePtr io_handle = makePlatformSpecificSocket(socket_fd, socket_v6only, domain, options,
+                                                     io_uring_worker_factory_.lock().get());
+  ZeroCopySendConfigSharedPtr zero_copy_send_config = zero_copy_send_config_.lock();
+  if (zero_copy_send_config != nullptr) {
+    // io_uring sockets don't write through IoSocketHandleImpl.
+    auto* io_socket_handle = dynamic_cast<IoSocketHandleImpl*>(io_handle.get());
+    if (io_socket_handle != nullptr) {
+      io_socket_handle->enableZeroCopySend(std::move(zero_copy_send_config));
+    }
+  }
+  return io_handle;
 }
 
 IoHandlePtr SocketInterfaceImpl::socket(Socket::Type socket_type, Address::Type addr_type,
@@ -165,12 +178,21 @@ bool SocketInterfaceImpl::ipFamilySupported(int domain) {
 }
 
 Server::BootstrapExtensionPtr SocketInterfaceImpl::createBootstrapExtension(
-    [[maybe_unused]] const Protobuf::Message& config,
-    [[maybe_unused]] Server::Configuration::ServerFactoryContext& context) {
-#if defined(__linux__) && !defined(__ANDROID_API__) && defined(ENVOY_ENABLE_IO_URING)
+    const Protobuf::Message& config, Server::Configuration::ServerFactoryContext& context) {
   const auto& message = MessageUtil::downcastAndValidate<
       const envoy::extensions::network::socket_interface::v3::DefaultSocketInterface&>(
       config, context.messageValidationVisitor());
+  ZeroCopySendConfigSharedPtr zero_copy_send_config;
+  if (message.has_zero_copy_send_options()) {
+    const auto& options = message.zero_copy_send_options();
+    const std::chrono::milliseconds close_timeout(
+        PROTOBUF_GET_WRAPPED_OR_DEFAULT(options, close_timeout_ms, 10000));
+    zero_copy_send_config = std::make_shared<ZeroCopySendConfig>(
+        PROTOBUF_GET_WRAPPED_OR_DEFAULT(options, min_write_size, 65536), close_timeout,
+        context.serverScope(), context.threadLocal());
+    zero_copy_send_config_ = zero_copy_send_config;
+  }
+#if defined(__linux__) && !defined(__ANDROID_API__) && defined(ENVOY_ENABLE_IO_URING)
   if (message.has_io_uring_options() && Io::isIoUringSupported()) {
     const auto& options = message.io_uring_options();
     std::shared_ptr<Io::IoUringWorkerFactoryImpl> io_uring_worker_factory =
@@ -179,16 +201,15 @@ Server::BootstrapExtensionPtr SocketInterfaceImpl::createBootstrapExtension(
             options.enable_submission_queue_polling(),
             PROTOBUF_GET_WRAPPED_OR_DEFAULT(options, read_buffer_size, 8192),
             PROTOBUF_GET_WRAPPED_OR_DEFAULT(options, write_timeout_ms, 1000),
-            context.threadLocal());
+            options.enable_batch_submission(), context.threadLocal());
     io_uring_worker_factory_ = io_uring_worker_factory;
 
-    return std::make_unique<DefaultSocketInterfaceExtension>(*this, io_uring_worker_factory);
-  } else {
-    return std::make_unique<DefaultSocketInterfaceExtension>(*this, nullptr);
+    return std::make_unique<DefaultSocketInterfaceExtension>(*this, io_uring_worker_factory,
+                                                             std::move(zero_copy_send_config));
   }
-#else
-  return std::make_unique<DefaultSocketInterfaceExtension>(*this, nullptr);
 #endif
+  return std::make_unique<DefaultSocketInterfaceExtension>(*this, nullptr,
+                                                           std::move(zero_copy_send_config));
 }
 
 ProtobufTypes::MessagePtr SocketInterfaceImpl::createEmptyConfigProto() {
@@ -3,6 +3,7 @@
 #include "envoy/common/io/io_uring.h"
 #include "envoy/network/socket.h"
 
+#include "source/common/network/io_socket_handle_impl.h"
 #include "source/common/network/socket_interface.h"
 
 namespace Envoy {
@@ -11,15 +12,18 @@ namespace Network {
 class DefaultSocketInterfaceExtension : public Network::SocketInterfaceExtension {
 public:
   DefaultSocketInterfaceExtension(Network::SocketInterface& sock_interface,
-                                  std::shared_ptr<Io::IoUringWorkerFactory> io_uring_worker_factory)
+                                  std::shared_ptr<Io::IoUringWorkerFactory> io_uring_worker_factory,
+                                  ZeroCopySendConfigSharedPtr zero_copy_send_config = nullptr)
       : Network::SocketInterfaceExtension(sock_interface),
-        io_uring_worker_factory_(io_uring_worker_factory) {}
+        io_uring_worker_factory_(io_uring_worker_factory),
+        zero_copy_send_config_(std::move(zero_copy_send_config)) {}
 
   // Server::BootstrapExtension
   void onWorkerThreadInitialized() override;
 
 protected:
   std::shared_ptr<Io::IoUringWorkerFactory> io_uring_worker_factory_;
+  ZeroCopySendConfigSharedPtr zero_copy_send_config_;
 };
 
 class SocketInterfaceImpl : public SocketInterfaceBase {
@@ -53,6 +57,7 @@ protected:
 
 private:
   std::weak_ptr<Io::IoUringWorkerFactory> io_uring_worker_factory_;
+  std::weak_ptr<ZeroCopySendConfig> zero_copy_send_config_;
 };
 
 DECLARE_FACTORY(SocketInterfaceImpl);
@@ -75,12 +75,13 @@ quic::QuicSocketAddress envoyIpAddressToQuicSocketAddress(const Network::Address
 
 quiche::HttpHeaderBlock envoyHeadersToHttp2HeaderBlock(const Http::HeaderMap& headers) {
   quiche::HttpHeaderBlock header_block;
-  headers.iterate([&header_block](const Http::HeaderEntry& header) -> Http::HeaderMap::Iterate {
-    // The key-value pairs are copied.
-    header_block.AppendValueOrAddHeader(header.key().getStringView(),
-                                        header.value().getStringView());
-    return Http::HeaderMap::Iterate::Continue;
-  });
+  headers.iterateForEncoding(
+      [&header_block](const Http::HeaderString& key,
+                      const Http::HeaderString& value) -> Http::HeaderMap::Iterate {
+        // The key-value pairs are copied.
+        header_block.AppendValueOrAddHeader(key.getStringView(), value.getStringView());
+        return Http::HeaderMap::Iterate::Continue;
+      });
   return header_block;
 }
 
@@ -10,7 +10,10 @@
 #include "source/common/network/address_impl.h"
 #include "source/common/network/connection_socket_impl.h"
 #include "source/common/quic/quic_io_handle_wrapper.h"
+#include "source/common/runtime/runtime_features.h"
 
+#include "absl/algorithm/container.h"
+#include "absl/strings/ascii.h"
 #include "openssl/ssl.h"
 #include "quiche/common/http/http_header_block.h"
 #include "quiche/quic/core/http/quic_header_list.h"
@@ -73,6 +76,8 @@ quicHeadersToEnvoyHeaders(const quic::QuicHeaderList& header_list, HeaderValidat
                           absl::string_view& details, quic::QuicRstStreamErrorCode& rst) {
   validator.startHeaderBlock();
   auto headers = T::create(max_headers_kb, max_headers_allowed);
+  const bool defer_materialization = Runtime::runtimeFeatureEnabled(
+      "envoy.reloadable_features.defer_decoded_header_materialization");
   for (const auto& entry : header_list) {
     if (max_headers_allowed == 0) {
       details = Http3ResponseCodeDetailValues::too_many_headers;
@@ -90,6 +95,13 @@ quicHeadersToEnvoyHeaders(const quic::QuicHeaderList& header_list, HeaderValidat
     case Http::HeaderUtility::HeaderValidationResult::DROP:
       continue;
     case Http::HeaderUtility::HeaderValidationResult::ACCEPT:
+      if (defer_materialization && entry.first != Http::Headers::get().Cookie.get() &&
+          !absl::c_any_of(entry.first, absl::ascii_isupper)) {
+        // The key is already lower case, so it can be copied as is without building a
+        // LowerCaseString.
+        headers->addCopyDeferred(entry.first, entry.second);
+        continue;
+      }
       auto key = Http::LowerCaseString(entry.first);
       if (key != Http::Headers::get().Cookie) {
         // TODO(danzh): Avoid copy by referencing entry as header_list is already validated by QUIC.
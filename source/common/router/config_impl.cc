@@ -1759,7 +1759,102 @@ VirtualHostImpl::VirtualHostImpl(const envoy::config::route::v3::VirtualHost& vi
       SET_AND_RETURN_IF_NOT_OK(route_or_error.status(), creation_status);
       routes_.emplace_back(route_or_error.value());
     }
+    if (virtual_host.index_path_routes()) {
+      path_route_index_ = std::make_unique<const PathRouteIndex>(routes_);
+    }
+  }
+}
+
+PathRouteIndex::PathRouteIndex(absl::Span<const RouteEntryImplBaseConstSharedPtr> routes)
+    : routes_(routes.begin(), routes.end()) {
+  const uint32_t size = routes_.size();
+  uint32_t run_begin = 0;
+  while (run_begin < size) {
+    uint32_t run_end = run_begin;
+    while (run_end < size && isIndexable(*routes_[run_end])) {
+      ++run_end;
+    }
+    if (run_end - run_begin >= MinIndexedRunLength) {
+      addIndexedSegment(run_begin, run_end);
+    } else {
+      // Short runs, and the non-indexable route that ends the run, are evaluated one by one.
+      run_end = std::max(run_end, run_begin + 1);
+      for (uint32_t i = run_begin; i < run_end; ++i) {
+        segments_.push_back(Segment{i, i + 1, false, {}, {}, {}});
+      }
+    }
+    run_begin = run_end;
+  }
+}
+
+bool PathRouteIndex::isIndexable(const RouteEntryImplBase& route) {
+  return route.case_sensitive() && (route.matchType() == PathMatchType::Prefix ||
+                                    route.matchType() == PathMatchType::Exact);
+}
+
+void PathRouteIndex::addIndexedSegment(uint32_t begin, uint32_t end) {
+  Segment& segment = segments_.emplace_back(Segment{begin, end, true, {}, {}, {}});
+  for (uint32_t i = begin; i < end; ++i) {
+    const RouteEntryImplBase& route = *routes_[i];
+    const std::string& key = route.matcher();
+    if (route.matchType() == PathMatchType::Exact) {
+      segment.exact_paths_[key].push_back(i);
+      continue;
+    }
+    uint32_t id = segment.prefixes_.find(key);
+    if (id == 0) {
+      segment.prefix_routes_.emplace_back();
+      id = segment.prefix_routes_.size();
+      segment.prefixes_.add(key, id);
+    }
+    segment.prefix_routes_[id - 1].push_back(i);
   }
+  indexed_route_count_ += end - begin;
+}
+
+RouteConstSharedPtr PathRouteIndex::match(const Http::RequestHeaderMap& headers,
+                                          const StreamInfo::StreamInfo& stream_info,
+                                          uint64_t random_value) const {
+  ASSERT(headers.Path() != nullptr);
+  absl::string_view path;
+  bool path_sanitized = false;
+  absl::InlinedVector<uint32_t, 8> candidates;
+  for (const Segment& segment : segments_) {
+    if (!segment.indexed_) {
+      if (RouteConstSharedPtr route = routes_[segment.begin_]->matches(headers, stream_info,
+                                                                       random_value);
+          route != nullptr) {
+        return route;
+      }
+      continue;
+    }
+
+    if (!path_sanitized) {
+      // Path sanitization only depends on the global route config, so it is the same for every
+      // route of the virtual host.
+      path = Http::PathUtil::removeQueryAndFragment(
+          routes_[segment.begin_]->sanitizePathBeforePathMatching(headers.getPathValue()));
+      path_sanitized = true;
+    }
+
+    candidates.clear();
+    for (const uint32_t id : segment.prefixes_.findMatchingPrefixes(path)) {
+      const RouteIndices& indices = segment.prefix_routes_[id - 1];
+      candidates.insert(candidates.end(), indices.begin(), indices.end());
+    }
+    if (const auto it = segment.exact_paths_.find(path); it != segment.exact_paths_.end()) {
+      candidates.insert(candidates.end(), it->second.begin(), it->second.end());
+    }
+    // Preserve first match semantics by evaluating the candidates in configuration order.
+    std::sort(candidates.begin(), candidates.end());
+    for (const uint32_t index : candidates) {
+      if (RouteConstSharedPtr route = routes_[index]->matches(headers, stream_info, random_value);
+          route != nullptr) {
+        return route;
+      }
+    }
+  }
+  return nullptr;
 }
 
 RouteConstSharedPtr VirtualHostImpl::getRouteFromRoutes(
@@ -1848,31 +1943,43 @@ RouteConstSharedPtr VirtualHostImpl::getRouteFromEntries(const RouteCallback& cb
     return nullptr;
   }
 
+  // The index does not support route callbacks, which need to know whether more routes follow the
+  // one being offered, nor requests without a path.
+  if (path_route_index_ != nullptr && cb == nullptr && headers.Path() != nullptr) {
+    RouteConstSharedPtr route = path_route_index_->match(headers, stream_info, random_value);
+    if (route == nullptr) {
+      ENVOY_LOG(debug, "route was resolved but final route list did not match incoming request");
+    }
+    return route;
+  }
+
   // Check for a route that matches the request.
   return getRouteFromRoutes(cb, headers, stream_info, random_value, routes_);
 }
 
-const VirtualHostImpl* RouteMatcher::findWildcardVirtualHost(
-    absl::string_view host, const RouteMatcher::WildcardVirtualHosts& wildcard_virtual_hosts,
-    RouteMatcher::SubstringFunction substring_function) const {
+const VirtualHostImpl* RouteMatcher::findWildcardVirtualHost(absl::string_view host) const {
   // We do a longest wildcard match against the host that's passed in
   // (e.g. "foo-bar.baz.com" should match "*-bar.baz.com" before matching "*.baz.com" for suffix
-  // wildcards). This is done by scanning the length => wildcards map looking for every wildcard
-  // whose size is < length.
-  for (const auto& iter : wildcard_virtual_hosts) {
-    const uint32_t wildcard_length = iter.first;
-    const auto& wildcard_map = iter.second;
-    // >= because *.foo.com shouldn't match .foo.com.
-    if (wildcard_length >= host.size()) {
-      continue;
-    }
-    const auto match = wildcard_map.find(substring_function(host, wildcard_length));
-    if (match != wildcard_map.end()) {
-      return match->second.get();
+  // wildcards). A wildcard must match at least one character, so *.foo.com doesn't match .foo.com;
+  // this is enforced by leaving the character the wildcard must cover out of the lookup key.
+  if (host.size() < 2) {
+    return nullptr;
+  }
+  if (!wildcard_virtual_host_suffixes_.empty()) {
+    // Reverse into an inline buffer, which covers typical host names without a heap allocation.
+    const absl::InlinedVector<char, 128> reversed_host(host.rbegin(), host.rend() - 1);
+    const VirtualHostImpl* vhost = wildcard_virtual_host_suffixes_.findLongestPrefix(
+        absl::string_view(reversed_host.data(), reversed_host.size()));
+    if (vhost != nullptr) {
+      return vhost;
     }
   }
+  if (!wildcard_virtual_host_prefixes_.empty()) {
+    return wildcard_virtual_host_prefixes_.findLongestPrefix(host.substr(0, host.size() - 1));
+  }
   return nullptr;
 }
+
 absl::StatusOr<std::unique_ptr<RouteMatcher>>
 RouteMatcher::create(const envoy::config::route::v3::RouteConfiguration& route_config,
                      const CommonConfigSharedPtr& global_route_config,
@@ -1898,6 +2005,7 @@ RouteMatcher::RouteMatcher(const envoy::config::route::v3::RouteConfiguration& r
         virtual_host_config, global_route_config, factory_context, *vhost_scope_, validator,
         validate_clusters, creation_status);
     SET_AND_RETURN_IF_NOT_OK(creation_status, creation_status);
+    bool has_wildcard_domain = false;
     for (const std::string& domain_name : virtual_host_config.domains()) {
       const Http::LowerCaseString lower_case_domain_name(domain_name);
       absl::string_view domain = lower_case_domain_name;
@@ -1910,13 +2018,14 @@ RouteMatcher::RouteMatcher(const envoy::config::route::v3::RouteConfiguration& r
         }
         default_virtual_host_ = virtual_host;
       } else if (!domain.empty() && '*' == domain[0]) {
-        duplicate_found = !wildcard_virtual_host_suffixes_[domain.size() - 1]
-                               .emplace(domain.substr(1), virtual_host)
-                               .second;
+        const std::string reversed_suffix(domain.rbegin(), domain.rend() - 1);
+        duplicate_found = !wildcard_virtual_host_suffixes_.add(reversed_suffix, virtual_host.get(),
+                                                               /*overwrite_existing=*/false);
+        has_wildcard_domain = true;
       } else if (!domain.empty() && '*' == domain[domain.size() - 1]) {
-        duplicate_found = !wildcard_virtual_host_prefixes_[domain.size() - 1]
-                               .emplace(domain.substr(0, domain.size() - 1), virtual_host)
-                               .second;
+        duplicate_found = !wildcard_virtual_host_prefixes_.add(
+            domain.substr(0, domain.size() - 1), virtual_host.get(), /*overwrite_existing=*/false);
+        has_wildcard_domain = true;
       } else {
         duplicate_found = !virtual_hosts_.emplace(domain, virtual_host).second;
       }
@@ -1928,6 +2037,9 @@ RouteMatcher::RouteMatcher(const envoy::config::route::v3::RouteConfiguration& r
         return;
       }
     }
+    if (has_wildcard_domain) {
+      wildcard_virtual_hosts_.push_back(std::move(virtual_host));
+    }
   }
 }
 
@@ -1960,21 +2072,8 @@ const VirtualHostImpl* RouteMatcher::findVirtualHost(const Http::RequestHeaderMa
   if (iter != virtual_hosts_.end()) {
     return iter->second.get();
   }
-  if (!wildcard_virtual_host_suffixes_.empty()) {
-    const VirtualHostImpl* vhost = findWildcardVirtualHost(
-        host, wildcard_virtual_host_suffixes_,
-        [](absl::string_view h, int l) -> absl::string_view { return h.substr(h.size() - l); });
-    if (vhost != nullptr) {
-      return vhost;
-    }
-  }
-  if (!wildcard_virtual_host_prefixes_.empty()) {
-    const VirtualHostImpl* vhost = findWildcardVirtualHost(
-        host, wildcard_virtual_host_prefixes_,
-        [](absl::string_view h, int l) -> absl::string_view { return h.substr(0, l); });
-    if (vhost != nullptr) {
-      return vhost;
-    }
+  if (const VirtualHostImpl* vhost = findWildcardVirtualHost(host); vhost != nullptr) {
+    return vhost;
   }
   return default_virtual_host_.get();
 }
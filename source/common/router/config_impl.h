@@ -23,6 +23,7 @@
 
 #include "source/common/common/matchers.h"
 #include "source/common/common/packed_struct.h"
+#include "source/common/common/radix_tree.h"
 #include "source/common/config/datasource.h"
 #include "source/common/config/metadata.h"
 #include "source/common/http/hash_policy.h"
@@ -36,6 +37,8 @@
 #include "source/common/router/tls_context_match_criteria_impl.h"
 #include "source/common/stats/symbol_table.h"
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/inlined_vector.h"
 #include "absl/container/node_hash_map.h"
 #include "absl/types/optional.h"
 
@@ -364,6 +367,56 @@ private:
   const bool include_is_timeout_retry_header_ : 1;
 };
 
+/**
+ * Index over a list of routes that narrows down, by request path, which prefix and exact path
+ * routes have to be evaluated. Runs of consecutive case sensitive prefix and exact path routes are
+ * indexed by a RadixTree of prefixes and a hash map of exact paths; every other route is always
+ * evaluated. Candidates are evaluated in configuration order with their full match logic, so the
+ * selected route is the same as the one found by a linear scan.
+ */
+class PathRouteIndex {
+public:
+  // Runs shorter than this are evaluated linearly; indexing them would not save any work.
+  static constexpr uint32_t MinIndexedRunLength = 4;
+
+  explicit PathRouteIndex(absl::Span<const RouteEntryImplBaseConstSharedPtr> routes);
+
+  /**
+   * @return the first route that matches the request, or nullptr. The request must have a path.
+   */
+  RouteConstSharedPtr match(const Http::RequestHeaderMap& headers,
+                            const StreamInfo::StreamInfo& stream_info, uint64_t random_value) const;
+
+  /**
+   * @return the number of routes that are looked up through an index rather than evaluated
+   *         linearly.
+   */
+  uint32_t indexedRouteCount() const { return indexed_route_count_; }
+
+private:
+  using RouteIndices = absl::InlinedVector<uint32_t, 1>;
+
+  struct Segment {
+    // Routes [begin_, end_) of routes_.
+    uint32_t begin_;
+    uint32_t end_;
+    // Whether the routes are looked up through prefixes_ and exact_paths_. Otherwise the segment
+    // holds a single route that is always evaluated.
+    bool indexed_;
+    // Values are 1-based indices into prefix_routes_, so that 0 can denote no value.
+    RadixTree<uint32_t> prefixes_;
+    std::vector<RouteIndices> prefix_routes_;
+    absl::flat_hash_map<std::string, RouteIndices> exact_paths_;
+  };
+
+  static bool isIndexable(const RouteEntryImplBase& route);
+  void addIndexedSegment(uint32_t begin, uint32_t end);
+
+  std::vector<RouteEntryImplBaseConstSharedPtr> routes_;
+  std::vector<Segment> segments_;
+  uint32_t indexed_route_count_{};
+};
+
 /**
  * Virtual host that holds a collection of routes.
  */
@@ -396,6 +449,8 @@ private:
   SslRequirements ssl_requirements_;
 
   std::vector<RouteEntryImplBaseConstSharedPtr> routes_;
+  // Only set if the virtual host opted into path route indexing.
+  std::unique_ptr<const PathRouteIndex> path_route_index_;
   Matcher::MatchTreeSharedPtr<Http::HttpMatchingData> matcher_;
 };
 
@@ -843,6 +898,7 @@ protected:
   std::unique_ptr<ConnectConfig> connect_config_;
 
   bool case_sensitive() const { return case_sensitive_; }
+  friend class PathRouteIndex;
   RouteConstSharedPtr clusterEntry(const Http::RequestHeaderMap& headers,
                                    const StreamInfo::StreamInfo& stream_info,
                                    uint64_t random_value) const;
@@ -1279,27 +1335,18 @@ private:
                ProtobufMessage::ValidationVisitor& validator, bool validate_clusters,
                absl::Status& creation_status);
 
-  using WildcardVirtualHosts =
-      std::map<int64_t, absl::node_hash_map<std::string, VirtualHostImplSharedPtr>, std::greater<>>;
-  using SubstringFunction = std::function<absl::string_view(absl::string_view, int)>;
-  const VirtualHostImpl* findWildcardVirtualHost(absl::string_view host,
-                                                 const WildcardVirtualHosts& wildcard_virtual_hosts,
-                                                 SubstringFunction substring_function) const;
+  const VirtualHostImpl* findWildcardVirtualHost(absl::string_view host) const;
   bool ignorePortInHostMatching() const { return ignore_port_in_host_matching_; }
 
   Stats::ScopeSharedPtr vhost_scope_;
   absl::node_hash_map<std::string, VirtualHostImplSharedPtr> virtual_hosts_;
-  // std::greater as a minor optimization to iterate from more to less specific
-  //
-  // A note on using an unordered_map versus a vector of (string, VirtualHostImplSharedPtr) pairs:
-  //
-  // Based on local benchmarks, each vector entry costs around 20ns for recall and (string)
-  // comparison with a fixed cost of about 25ns. For unordered_map, the empty map costs about 65ns
-  // and climbs to about 110ns once there are any entries.
-  //
-  // The break-even is 4 entries.
-  WildcardVirtualHosts wildcard_virtual_host_suffixes_;
-  WildcardVirtualHosts wildcard_virtual_host_prefixes_;
+  // Wildcard domains, keyed by the domain without its wildcard character. Suffix wildcards are
+  // keyed by the reversed suffix, so that both kinds resolve to the longest matching wildcard with
+  // a single walk over the host, independent of the number of distinct wildcard lengths.
+  RadixTree<const VirtualHostImpl*> wildcard_virtual_host_suffixes_;
+  RadixTree<const VirtualHostImpl*> wildcard_virtual_host_prefixes_;
+  // Owns the virtual hosts referenced by the wildcard tables.
+  std::vector<VirtualHostImplSharedPtr> wildcard_virtual_hosts_;
 
   VirtualHostImplSharedPtr default_virtual_host_;
   const bool ignore_port_in_host_matching_{false};
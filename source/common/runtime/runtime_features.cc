@@ -148,6 +148,9 @@ FALSE_RUNTIME_GUARD(envoy_reloadable_features_connection_close_through_filter_ma
 // TODO(adisuissa): flip to true after all xDS types use the new subscription
 // method, and this is tested extensively.
 FALSE_RUNTIME_GUARD(envoy_reloadable_features_xdstp_based_config_singleton_subscriptions);
+// TODO(agent): flip to true once deferred headers being iterated after eagerly added ones has been
+// validated in production.
+FALSE_RUNTIME_GUARD(envoy_reloadable_features_defer_decoded_header_materialization);
 
 // A flag to set the maximum TLS version for google_grpc client to TLS1.2, when needed for
 // compliance restrictions.
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <thread>
 
 #include "envoy/stats/sink.h"
 #include "envoy/stats/stats.h"
@@ -16,7 +17,9 @@
 #include "source/common/stats/stat_merger.h"
 #include "source/common/stats/symbol_table.h"
 
+#include "absl/base/optimization.h"
 #include "absl/container/flat_hash_set.h"
+#include "absl/numeric/bits.h"
 
 namespace Envoy {
 namespace Stats {
@@ -121,6 +124,12 @@ public:
   virtual void removeFromSetLockHeld() ABSL_EXCLUSIVE_LOCKS_REQUIRED(alloc_.mutex_) PURE;
 
 protected:
+  // Clears the Changed flag, returning whether it was set.
+  bool latchChangedFlag() {
+    return flags_.fetch_and(static_cast<uint16_t>(~Metric::Flags::Changed)) &
+           Metric::Flags::Changed;
+  }
+
   AllocatorImpl& alloc_;
 
   // ref_count_ can be incremented as an atomic, without taking a new lock, as
@@ -167,6 +176,80 @@ private:
   std::atomic<uint64_t> pending_increment_{0};
 };
 
+// A counter whose value is split across per-thread shards, each on its own
+// cache line, so that threads incrementing it concurrently do not contend for
+// a single line. Reads and latches sum all shards, and each counter costs a
+// cache line per shard, so this is only used for the hot counters selected via
+// AllocatorImpl::setShardedCounters().
+class ShardedCounterImpl : public StatsSharedImpl<Counter> {
+public:
+  ShardedCounterImpl(StatName name, AllocatorImpl& alloc, StatName tag_extracted_name,
+                     const StatNameTagVector& stat_name_tags)
+      : StatsSharedImpl(name, alloc, tag_extracted_name, stat_name_tags),
+        shards_(std::make_unique<Shard[]>(numShards())) {}
+
+  void removeFromSetLockHeld() ABSL_EXCLUSIVE_LOCKS_REQUIRED(alloc_.mutex_) override {
+    const size_t count = alloc_.counters_.erase(statName());
+    ASSERT(count == 1);
+    alloc_.sinked_counters_.erase(this);
+  }
+
+  // Stats::Counter
+  void add(uint64_t amount) override {
+    shards_[shardIndex()].value_.fetch_add(amount, std::memory_order_relaxed);
+    // Only write the shared flags word when the bit is not already set, so
+    // that steady-state increments leave its cache line shared.
+    if (!(flags_.load(std::memory_order_relaxed) & Flags::Used)) {
+      flags_ |= Flags::Used;
+    }
+  }
+  void inc() override { add(1); }
+  uint64_t latch() override {
+    const uint64_t total = sum();
+    return total - latched_total_.exchange(total);
+  }
+  // The shards are never cleared, as other threads may be writing to them;
+  // value() instead reports the total relative to the one at the last reset.
+  void reset() override { reset_total_ = sum(); }
+  uint64_t value() const override { return sum() - reset_total_; }
+
+private:
+  struct alignas(ABSL_CACHELINE_SIZE) Shard {
+    std::atomic<uint64_t> value_{0};
+  };
+
+  // One shard per CPU, rounded up to a power of two so a thread's shard can be
+  // found with a mask.
+  static uint32_t numShards() {
+    static const uint32_t num_shards =
+        absl::bit_ceil(std::clamp(std::thread::hardware_concurrency(), 1U, MaxShards));
+    return num_shards;
+  }
+
+  // Threads are assigned shards round-robin on their first increment of any
+  // sharded counter. With no more threads than shards, as with one worker per
+  // CPU, no two threads share a shard.
+  static uint32_t shardIndex() {
+    static std::atomic<uint32_t> next_thread_index{0};
+    thread_local const uint32_t thread_index = next_thread_index++;
+    return thread_index & (numShards() - 1);
+  }
+
+  uint64_t sum() const {
+    uint64_t total = 0;
+    for (uint32_t i = 0, n = numShards(); i < n; ++i) {
+      total += shards_[i].value_.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+  static constexpr uint32_t MaxShards = 64;
+
+  std::unique_ptr<Shard[]> shards_;
+  std::atomic<uint64_t> latched_total_{0};
+  std::atomic<uint64_t> reset_total_{0};
+};
+
 class GaugeImpl : public StatsSharedImpl<Gauge> {
 public:
   GaugeImpl(StatName name, AllocatorImpl& alloc, StatName tag_extracted_name,
@@ -201,18 +284,19 @@ public:
   // Stats::Gauge
   void add(uint64_t amount) override {
     child_value_ += amount;
-    flags_ |= Flags::Used;
+    flags_ |= Flags::Used | Flags::Changed;
   }
   void dec() override { sub(1); }
   void inc() override { add(1); }
   void set(uint64_t value) override {
     child_value_ = value;
-    flags_ |= Flags::Used;
+    flags_ |= Flags::Used | Flags::Changed;
   }
   void sub(uint64_t amount) override {
     ASSERT(child_value_ >= amount);
     ASSERT(used() || amount == 0);
     child_value_ -= amount;
+    flags_ |= Flags::Changed;
   }
   uint64_t value() const override { return child_value_ + parent_value_; }
 
@@ -261,7 +345,11 @@ public:
     }
   }
 
-  void setParentValue(uint64_t value) override { parent_value_ = value; }
+  void setParentValue(uint64_t value) override {
+    parent_value_ = value;
+    flags_ |= Flags::Changed;
+  }
+  bool latchChanged() override { return latchChangedFlag(); }
 
 private:
   std::atomic<uint64_t> parent_value_{0};
@@ -285,12 +373,13 @@ public:
     std::string value_copy(value);
     absl::MutexLock lock(&mutex_);
     value_ = std::move(value_copy);
-    flags_ |= Flags::Used;
+    flags_ |= Flags::Used | Flags::Changed;
   }
   std::string value() const override {
     absl::MutexLock lock(&mutex_);
     return value_;
   }
+  bool latchChanged() override { return latchChangedFlag(); }
 
 private:
   mutable absl::Mutex mutex_;
@@ -306,7 +395,10 @@ CounterSharedPtr AllocatorImpl::makeCounter(StatName name, StatName tag_extracte
   if (iter != counters_.end()) {
     return {*iter};
   }
-  auto counter = CounterSharedPtr(makeCounterInternal(name, tag_extracted_name, stat_name_tags));
+  auto counter = CounterSharedPtr(
+      sharded_counter_names_.contains(tag_extracted_name)
+          ? new ShardedCounterImpl(name, *this, tag_extracted_name, stat_name_tags)
+          : makeCounterInternal(name, tag_extracted_name, stat_name_tags));
   counters_.insert(counter.get());
   // Add counter to sinked_counters_ if it matches the sink predicate.
   if (sink_predicates_ != nullptr && sink_predicates_->includeCounter(*counter)) {
@@ -370,6 +462,15 @@ Counter* AllocatorImpl::makeCounterInternal(StatName name, StatName tag_extracte
   return new CounterImpl(name, *this, tag_extracted_name, stat_name_tags);
 }
 
+void AllocatorImpl::setShardedCounters(const std::vector<std::string>& tag_extracted_names) {
+  Thread::LockGuard lock(mutex_);
+  sharded_counter_names_.clear();
+  sharded_counter_pool_.clear();
+  for (const std::string& name : tag_extracted_names) {
+    sharded_counter_names_.insert(sharded_counter_pool_.add(name));
+  }
+}
+
 void AllocatorImpl::forEachCounter(SizeFn f_size, StatFn<Counter> f_stat) const {
   Thread::LockGuard lock(mutex_);
   if (f_size != nullptr) {
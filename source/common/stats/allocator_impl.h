@@ -1,5 +1,6 @@
 #pragma once
 
+#include <string>
 #include <vector>
 
 #include "envoy/common/optref.h"
@@ -9,6 +10,7 @@
 
 #include "source/common/common/thread_synchronizer.h"
 #include "source/common/stats/metric_impl.h"
+#include "source/common/stats/symbol_table.h"
 
 #include "absl/container/flat_hash_set.h"
 #include "absl/strings/string_view.h"
@@ -20,7 +22,8 @@ class AllocatorImpl : public Allocator {
 public:
   static const char DecrementToZeroSyncPoint[];
 
-  AllocatorImpl(SymbolTable& symbol_table) : symbol_table_(symbol_table) {}
+  AllocatorImpl(SymbolTable& symbol_table)
+      : symbol_table_(symbol_table), sharded_counter_pool_(symbol_table) {}
   ~AllocatorImpl() override;
 
   // Allocator
@@ -45,6 +48,7 @@ public:
   void forEachSinkedTextReadout(SizeFn f_size, StatFn<TextReadout> f_stat) const override;
 
   void setSinkPredicates(std::unique_ptr<SinkPredicates>&& sink_predicates) override;
+  void setShardedCounters(const std::vector<std::string>& tag_extracted_names) override;
 #ifndef ENVOY_CONFIG_COVERAGE
   void debugPrint();
 #endif
@@ -71,6 +75,7 @@ private:
   template <class BaseClass> friend class StatsSharedImpl;
   friend class CounterImpl;
   friend class GaugeImpl;
+  friend class ShardedCounterImpl;
   friend class TextReadoutImpl;
   friend class NotifyingAllocatorImpl;
 
@@ -94,6 +99,11 @@ private:
   std::unique_ptr<SinkPredicates> sink_predicates_;
   SymbolTable& symbol_table_;
 
+  // Tag-extracted names of counters that are created as ShardedCounterImpl.
+  // The pool owns the storage for the names in the set.
+  StatNamePool sharded_counter_pool_ ABSL_GUARDED_BY(mutex_);
+  StatNameHashSet sharded_counter_names_ ABSL_GUARDED_BY(mutex_);
+
   Thread::ThreadSynchronizer sync_;
 
   // Retain storage for deleted stats; these are no longer in maps because
@@ -1,6 +1,7 @@
 #include "source/common/stats/histogram_impl.h"
 
 #include <algorithm>
+#include <cmath>
 #include <string>
 
 #include "source/common/common/utility.h"
@@ -99,6 +100,58 @@ void HistogramStatisticsImpl::refresh(const histogram_t* new_histogram_ptr) {
   out_of_bound_count_ = hist_approx_count_above(new_histogram_ptr, supported_buckets.back());
 }
 
+ExponentialHistogram
+ExponentialHistogram::fromBuckets(const std::vector<ParentHistogram::Bucket>& buckets,
+                                  Histogram::Unit unit, int32_t min_scale, int32_t max_scale,
+                                  uint32_t max_buckets) {
+  ASSERT(min_scale <= max_scale);
+  ASSERT(max_buckets > 0);
+  const double value_scale = unit == Histogram::Unit::Percent ? Histogram::PercentScale : 1;
+
+  // Index every populated bin at max_scale. Bucket i holds (base^i, base^(i+1)], so the index
+  // of a value is ceil(log2(value) * 2^scale) - 1.
+  ExponentialHistogram result;
+  std::vector<std::pair<int64_t, uint64_t>> indexed;
+  indexed.reserve(buckets.size());
+  for (const ParentHistogram::Bucket& bucket : buckets) {
+    if (bucket.count_ == 0) {
+      continue;
+    }
+    const double value = (bucket.lower_bound_ + bucket.width_ / 2) / value_scale;
+    if (value <= 0) {
+      result.zero_count_ += bucket.count_;
+      continue;
+    }
+    const int64_t index =
+        static_cast<int64_t>(std::ceil(std::ldexp(std::log2(value), max_scale))) - 1;
+    indexed.emplace_back(index, bucket.count_);
+  }
+
+  result.scale_ = max_scale;
+  if (indexed.empty()) {
+    return result;
+  }
+
+  const auto [min_it, max_it] = std::minmax_element(indexed.begin(), indexed.end());
+  int64_t min_index = min_it->first;
+  int64_t max_index = max_it->first;
+  // Halving the resolution merges bucket pairs; an arithmetic shift rounds toward negative
+  // infinity, which keeps the bucket boundaries aligned for negative indices too.
+  while (max_index - min_index >= max_buckets && result.scale_ > min_scale) {
+    min_index >>= 1;
+    max_index >>= 1;
+    --result.scale_;
+  }
+
+  const int32_t shift = max_scale - result.scale_;
+  result.offset_ = min_index;
+  result.bucket_counts_.resize(max_index - min_index + 1);
+  for (const auto& [index, count] : indexed) {
+    result.bucket_counts_[(index >> shift) - min_index] += count;
+  }
+  return result;
+}
+
 HistogramSettingsImpl::HistogramSettingsImpl(const envoy::config::metrics::v3::StatsConfig& config,
                                              Server::Configuration::CommonFactoryContext& context)
     : configs_([&config, &context]() {
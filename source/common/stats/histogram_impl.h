@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "envoy/config/metrics/v3/stats.pb.h"
 #include "envoy/stats/histogram.h"
@@ -73,6 +74,34 @@ private:
   const Histogram::Unit unit_{Histogram::Unit::Unspecified};
 };
 
+/**
+ * A base-2 exponential histogram derived from the log-linear bins of a circllhist, in the form
+ * used by OpenTelemetry exponential histograms and Prometheus native histograms. Bucket
+ * `offset_ + i` counts the values in (base^(offset_ + i), base^(offset_ + i + 1)], where
+ * base = 2^(2^-scale_). Only the range between the lowest and highest populated buckets is
+ * represented, so a histogram with few distinct values needs only a few buckets.
+ */
+struct ExponentialHistogram {
+  /**
+   * Builds an exponential histogram from circllhist bins. Each bin is assigned to the bucket
+   * holding its midpoint. The scale starts at max_scale and is reduced until the populated range
+   * fits in max_buckets, or min_scale is reached.
+   * @param buckets the detailed buckets of a ParentHistogram.
+   * @param unit the unit of the histogram; Percent values are scaled down to fractions.
+   * @param min_scale the lowest scale the format can represent.
+   * @param max_scale the highest scale to use.
+   * @param max_buckets the maximum number of buckets to produce, if allowed by min_scale.
+   */
+  static ExponentialHistogram fromBuckets(const std::vector<ParentHistogram::Bucket>& buckets,
+                                          Histogram::Unit unit, int32_t min_scale,
+                                          int32_t max_scale, uint32_t max_buckets);
+
+  int32_t scale_{0};
+  uint64_t zero_count_{0};
+  int32_t offset_{0};
+  std::vector<uint64_t> bucket_counts_;
+};
+
 class HistogramImplHelper : public MetricImpl<Histogram> {
 public:
   HistogramImplHelper(StatName name, StatName tag_extracted_name,
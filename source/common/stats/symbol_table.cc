@@ -261,11 +261,8 @@ bool StatName::startsWith(StatName prefix) const {
 
 std::vector<absl::string_view> SymbolTable::decodeStrings(StatName stat_name) const {
   std::vector<absl::string_view> strings;
-  Thread::LockGuard lock(lock_);
   Encoding::decodeTokens(
-      stat_name,
-      [this, &strings](Symbol symbol)
-          ABSL_NO_THREAD_SAFETY_ANALYSIS { strings.push_back(fromSymbol(symbol)); },
+      stat_name, [this, &strings](Symbol symbol) { strings.push_back(fromSymbol(symbol)); },
       [&strings](absl::string_view str) { strings.push_back(str); });
   return strings;
 }
@@ -286,6 +283,71 @@ void SymbolTable::Encoding::appendToMemBlock(StatName stat_name,
   }
 }
 
+SymbolTable::DecodeTable::~DecodeTable() {
+  for (const std::unique_ptr<Chunk>& chunk : chunks_) {
+    for (std::atomic<InlineString*>& token : *chunk) {
+      InlineStringPtr str(token.load(std::memory_order_relaxed));
+    }
+  }
+}
+
+const InlineString* SymbolTable::DecodeTable::find(Symbol symbol) const {
+  // The acquire loads pair with the release stores in insert(), so that the
+  // pointed-to directory, chunk and string are fully constructed.
+  const Directory* directory = current_.load(std::memory_order_acquire);
+  const uint32_t index = symbol >> ChunkBits;
+  if (directory == nullptr || index >= directory->size_) {
+    return nullptr;
+  }
+  const Chunk* chunk = directory->chunks_[index].load(std::memory_order_acquire);
+  if (chunk == nullptr) {
+    return nullptr;
+  }
+  return (*chunk)[symbol & (ChunkSize - 1)].load(std::memory_order_acquire);
+}
+
+std::atomic<InlineString*>& SymbolTable::DecodeTable::entry(Symbol symbol) {
+  const uint32_t index = symbol >> ChunkBits;
+  Directory* directory = directories_.empty() ? nullptr : directories_.back().get();
+  if (directory == nullptr || index >= directory->size_) {
+    uint32_t size = directory == nullptr ? InitialDirectorySize : directory->size_;
+    while (size <= index) {
+      size *= 2;
+    }
+    auto grown = std::make_unique<Directory>(size);
+    for (uint32_t i = 0; directory != nullptr && i < directory->size_; ++i) {
+      grown->chunks_[i].store(directory->chunks_[i].load(std::memory_order_relaxed),
+                              std::memory_order_relaxed);
+    }
+    // Lookups may still be using the previous directory, so it is kept.
+    directory = grown.get();
+    directories_.push_back(std::move(grown));
+    current_.store(directory, std::memory_order_release);
+  }
+
+  Chunk* chunk = directory->chunks_[index].load(std::memory_order_relaxed);
+  if (chunk == nullptr) {
+    chunks_.push_back(std::make_unique<Chunk>());
+    chunk = chunks_.back().get();
+    directory->chunks_[index].store(chunk, std::memory_order_release);
+  }
+  return (*chunk)[symbol & (ChunkSize - 1)];
+}
+
+void SymbolTable::DecodeTable::insert(Symbol symbol, InlineStringPtr str) {
+  std::atomic<InlineString*>& token = entry(symbol);
+  ASSERT(token.load(std::memory_order_relaxed) == nullptr);
+  token.store(str.release(), std::memory_order_release);
+  ++size_;
+}
+
+void SymbolTable::DecodeTable::erase(Symbol symbol) {
+  std::atomic<InlineString*>& token = entry(symbol);
+  InlineStringPtr str{token.exchange(nullptr, std::memory_order_relaxed)};
+  ASSERT(str != nullptr);
+  --size_;
+}
+
 SymbolTable::SymbolTable()
     // Have to be explicitly initialized, if we want to use the ABSL_GUARDED_BY macro.
     : next_symbol_(FirstValidSymbol), monotonic_counter_(FirstValidSymbol) {}
@@ -332,7 +394,7 @@ void SymbolTable::addTokensToEncoding(const absl::string_view name, Encoding& en
 
 uint64_t SymbolTable::numSymbols() const {
   Thread::LockGuard lock(lock_);
-  ASSERT(encode_map_.size() == decode_map_.size());
+  ASSERT(encode_map_.size() == decode_table_.size());
   return encode_map_.size();
 }
 
@@ -346,13 +408,13 @@ void SymbolTable::incRefCount(const StatName& stat_name) {
 
   Thread::LockGuard lock(lock_);
   for (Symbol symbol : symbols) {
-    auto decode_search = decode_map_.find(symbol);
+    const InlineString* token = decode_table_.find(symbol);
 
-    ASSERT(decode_search != decode_map_.end(),
+    ASSERT(token != nullptr,
            "Please see "
            "https://github.com/envoyproxy/envoy/blob/main/source/docs/stats.md#"
            "debugging-symbol-table-assertions");
-    auto encode_search = encode_map_.find(decode_search->second->toStringView());
+    auto encode_search = encode_map_.find(token->toStringView());
     ASSERT(encode_search != encode_map_.end(),
            "Please see "
            "https://github.com/envoyproxy/envoy/blob/main/source/docs/stats.md#"
@@ -368,10 +430,10 @@ void SymbolTable::free(const StatName& stat_name) {
 
   Thread::LockGuard lock(lock_);
   for (Symbol symbol : symbols) {
-    auto decode_search = decode_map_.find(symbol);
-    ASSERT(decode_search != decode_map_.end());
+    const InlineString* token = decode_table_.find(symbol);
+    ASSERT(token != nullptr);
 
-    auto encode_search = encode_map_.find(decode_search->second->toStringView());
+    auto encode_search = encode_map_.find(token->toStringView());
     ASSERT(encode_search != encode_map_.end());
 
     // If that was the last remaining client usage of the symbol, erase the
@@ -381,8 +443,10 @@ void SymbolTable::free(const StatName& stat_name) {
     // symbol_table_speed_test.cc, relative to breaking out the decrement into a
     // separate step, likely due to the non-trivial dereferences in EXPR.
     if (--encode_search->second.ref_count_ == 0) {
-      decode_map_.erase(decode_search);
+      // The encode map is keyed by a view of the string owned by the decode
+      // table, so it must be erased first.
       encode_map_.erase(encode_search);
+      decode_table_.erase(symbol);
       pool_.push(symbol);
     }
   }
@@ -469,15 +533,13 @@ Symbol SymbolTable::toSymbol(absl::string_view sv) {
   auto encode_find = encode_map_.find(sv);
   // If the string segment doesn't already exist,
   if (encode_find == encode_map_.end()) {
-    // We create the actual string, place it in the decode_map_, and then insert
-    // a string_view pointing to it in the encode_map_. This allows us to only
-    // store the string once. We use unique_ptr so copies are not made as
-    // flat_hash_map moves values around.
+    // We create the actual string, place it in the decode_table_, and then
+    // insert a string_view pointing to it in the encode_map_. This allows us to
+    // only store the string once.
     InlineStringPtr str = InlineString::create(sv);
     auto encode_insert = encode_map_.insert({str->toStringView(), SharedSymbol(next_symbol_)});
     ASSERT(encode_insert.second);
-    auto decode_insert = decode_map_.insert({next_symbol_, std::move(str)});
-    ASSERT(decode_insert.second);
+    decode_table_.insert(next_symbol_, std::move(str));
 
     result = next_symbol_;
     newSymbol();
@@ -490,11 +552,10 @@ Symbol SymbolTable::toSymbol(absl::string_view sv) {
   return result;
 }
 
-absl::string_view SymbolTable::fromSymbol(const Symbol symbol) const
-    ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_) {
-  auto search = decode_map_.find(symbol);
-  RELEASE_ASSERT(search != decode_map_.end(), "no such symbol");
-  return search->second->toStringView();
+absl::string_view SymbolTable::fromSymbol(const Symbol symbol) const {
+  const InlineString* token = decode_table_.find(symbol);
+  RELEASE_ASSERT(token != nullptr, "no such symbol");
+  return token->toStringView();
 }
 
 void SymbolTable::newSymbol() ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_) {
@@ -509,15 +570,6 @@ void SymbolTable::newSymbol() ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_) {
 }
 
 bool SymbolTable::lessThan(const StatName& a, const StatName& b) const {
-  // Proactively take the table lock in anticipation that we'll need to
-  // convert at least one symbol to a string_view, and it's easier not to
-  // bother to lazily take the lock.
-  Thread::LockGuard lock(lock_);
-  return lessThanLockHeld(a, b);
-}
-
-bool SymbolTable::lessThanLockHeld(const StatName& a, const StatName& b) const
-    ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_) {
   Encoding::TokenIter a_iter(a), b_iter(b);
   while (true) {
     Encoding::TokenIter::TokenType a_type = a_iter.next();
@@ -549,12 +601,12 @@ bool SymbolTable::lessThanLockHeld(const StatName& a, const StatName& b) const
 void SymbolTable::debugPrint() const {
   Thread::LockGuard lock(lock_);
   std::vector<Symbol> symbols;
-  for (const auto& p : decode_map_) {
-    symbols.push_back(p.first);
+  for (const auto& p : encode_map_) {
+    symbols.push_back(p.second.symbol_);
   }
   std::sort(symbols.begin(), symbols.end());
   for (Symbol symbol : symbols) {
-    const InlineString& token = *decode_map_.find(symbol)->second;
+    const InlineString& token = *decode_table_.find(symbol);
     const SharedSymbol& shared_symbol = encode_map_.find(token.toStringView())->second;
     ENVOY_LOG_MISC(info, "{}: '{}' ({})", symbol, token.toStringView(), shared_symbol.ref_count_);
   }
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <memory>
 #include <stack>
 #include <string>
@@ -233,7 +235,7 @@ public:
    *
    * Note that this operation has to be performed with the context of the
    * SymbolTable so that the individual Symbol objects can be converted
-   * into strings for lexical comparison.
+   * into strings for lexical comparison. This does not take the table lock.
    *
    * @param a the first stat name
    * @param b the second stat name
@@ -324,8 +326,6 @@ public:
    */
   DynamicSpans getDynamicSpans(StatName stat_name) const;
 
-  bool lessThanLockHeld(const StatName& a, const StatName& b) const;
-
   template <class GetStatName, class Obj> struct StatNameCompare {
     StatNameCompare(const SymbolTable& symbol_table, GetStatName getter)
         : symbol_table_(symbol_table), getter_(getter) {}
@@ -337,9 +337,8 @@ public:
   };
 
   /**
-   * Sorts a range by StatName. This API is more efficient than
-   * calling std::sort directly as it takes a single lock for the
-   * entire sort, rather than locking on each comparison.
+   * Sorts a range by StatName, decoding symbols only for the tokens that
+   * differ between the compared names.
    *
    * @param begin the beginning of the range to sort
    * @param end the end of the range to sort
@@ -347,9 +346,6 @@ public:
    */
   template <class Obj, class Iter, class GetStatName>
   void sortByStatNames(Iter begin, Iter end, GetStatName get_stat_name) const {
-    // Grab the lock once before sorting begins, so we don't have to re-take
-    // it on every comparison.
-    Thread::LockGuard lock(lock_);
     StatNameCompare<GetStatName, Obj> compare(*this, get_stat_name);
     std::sort(begin, end, compare);
   }
@@ -402,7 +398,73 @@ private:
     uint32_t ref_count_{1};
   };
 
-  // This must be held during both encode() and free().
+  /**
+   * Maps symbols back to their strings. Symbols are small integers, allocated
+   * densely from monotonic_counter_ and recycled through pool_, so they index
+   * fixed-size chunks of string pointers rather than a hash map.
+   *
+   * Lookups don't take lock_, so that decoding stat names on workers and on
+   * the admin thread doesn't contend with encoding. Mutations are made with
+   * lock_ held. Chunks are never moved or freed while the table is alive, and
+   * when the directory of chunks grows, the new one is published atomically
+   * and the previous ones are kept until destruction for the readers still
+   * holding them.
+   *
+   * A string is deleted when the last reference to its symbol is freed. A
+   * symbol can only be decoded through a StatName holding a reference to it,
+   * so no reader can be using the string by then, and no further grace period
+   * is needed before reclaiming it.
+   */
+  class DecodeTable {
+  public:
+    ~DecodeTable();
+
+    /**
+     * @param symbol the symbol to look up.
+     * @return the string for the symbol, or nullptr if it is not allocated.
+     */
+    const InlineString* find(Symbol symbol) const;
+
+    /**
+     * Maps a symbol which is not allocated to str. Requires the table lock.
+     */
+    void insert(Symbol symbol, InlineStringPtr str);
+
+    /**
+     * Deletes the string for an allocated symbol. Requires the table lock.
+     */
+    void erase(Symbol symbol);
+
+    /**
+     * @return the number of allocated symbols. Requires the table lock.
+     */
+    uint64_t size() const { return size_; }
+
+  private:
+    static constexpr uint32_t ChunkBits = 8;
+    static constexpr uint32_t ChunkSize = 1 << ChunkBits;
+    static constexpr uint32_t InitialDirectorySize = 16;
+    using Chunk = std::array<std::atomic<InlineString*>, ChunkSize>;
+
+    struct Directory {
+      explicit Directory(uint32_t size)
+          : size_(size), chunks_(std::make_unique<std::atomic<Chunk*>[]>(size)) {}
+
+      const uint32_t size_;
+      std::unique_ptr<std::atomic<Chunk*>[]> chunks_;
+    };
+
+    std::atomic<InlineString*>& entry(Symbol symbol);
+
+    // The directory used by lookups, which is the last of directories_.
+    std::atomic<const Directory*> current_{};
+    std::vector<std::unique_ptr<Directory>> directories_;
+    std::vector<std::unique_ptr<Chunk>> chunks_;
+    uint64_t size_{};
+  };
+
+  // This must be held during both encode() and free(). It isn't needed to
+  // decode symbols.
   mutable Thread::MutexBasicLockable lock_;
 
   /**
@@ -434,7 +496,7 @@ private:
    * @param symbol the individual symbol to be decoded.
    * @return absl::string_view the decoded string.
    */
-  absl::string_view fromSymbol(Symbol symbol) const ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  absl::string_view fromSymbol(Symbol symbol) const;
 
   /**
    * Stages a new symbol for use. To be called after a successful insertion.
@@ -464,11 +526,10 @@ private:
 
   // Bitmap implementation.
   // The encode map stores both the symbol and the ref count of that symbol.
-  // Using absl::string_view lets us only store the complete string once, in the decode map.
+  // Using absl::string_view lets us only store the complete string once, in the decode table.
   using EncodeMap = absl::flat_hash_map<absl::string_view, SharedSymbol>;
-  using DecodeMap = absl::flat_hash_map<Symbol, InlineStringPtr>;
   EncodeMap encode_map_ ABSL_GUARDED_BY(lock_);
-  DecodeMap decode_map_ ABSL_GUARDED_BY(lock_);
+  DecodeTable decode_table_;
 
   // Free pool of symbols for re-use.
   // TODO(ambuc): There might be an optimization here relating to storing ranges of freed symbols
@@ -1065,7 +1126,7 @@ template <class GetStatName, class Obj>
 bool SymbolTable::StatNameCompare<GetStatName, Obj>::operator()(const Obj& a, const Obj& b) const {
   StatName a_stat_name = getter_(a);
   StatName b_stat_name = getter_(b);
-  return symbol_table_.lessThanLockHeld(a_stat_name, b_stat_name);
+  return symbol_table_.lessThan(a_stat_name, b_stat_name);
 }
 
 using SymbolTablePtr = std::unique_ptr<SymbolTable>;
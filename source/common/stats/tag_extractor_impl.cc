@@ -1,5 +1,6 @@
 #include "source/common/stats/tag_extractor_impl.h"
 
+#include <algorithm>
 #include <cstring>
 #include <string>
 
@@ -33,6 +34,18 @@ const std::vector<absl::string_view>& TagExtractionContext::tokens() {
   return tokens_;
 }
 
+void TagExtractionContext::setPrefilterMatches(std::vector<int>&& matches) {
+  prefilter_matches_ = std::move(matches);
+  std::sort(prefilter_matches_.begin(), prefilter_matches_.end());
+  has_prefilter_matches_ = true;
+}
+
+bool TagExtractionContext::prefilterRejects(int prefilter_index) const {
+  return has_prefilter_matches_ && prefilter_index >= 0 &&
+         !std::binary_search(prefilter_matches_.begin(), prefilter_matches_.end(),
+                             prefilter_index);
+}
+
 namespace {
 
 bool regexStartsWithDot(absl::string_view regex) {
@@ -152,7 +165,7 @@ bool TagExtractorRe2Impl::extractTag(TagExtractionContext& context, std::vector<
   PERF_OPERATION(perf);
 
   absl::string_view stat_name = context.name();
-  if (substrMismatch(stat_name)) {
+  if (substrMismatch(stat_name) || context.prefilterRejects(prefilter_index_)) {
     PERF_RECORD(perf, "re2-skip", name_);
     PERF_TAG_INC(skipped_);
     return false;
@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <regex>
 #include <string>
+#include <vector>
 
 #ifdef ENVOY_PERF_ANNOTATION
 #include <fmt/core.h>
@@ -26,9 +27,24 @@ public:
   absl::string_view name() { return name_; }
   const std::vector<absl::string_view>& tokens();
 
+  /**
+   * Records which regexes of a combined prefilter matched the name. See
+   * TagProducerImpl for how the prefilter is built.
+   * @param matches the prefilter indices of the matching regexes, in any order.
+   */
+  void setPrefilterMatches(std::vector<int>&& matches);
+
+  /**
+   * @param prefilter_index the index of an extractor's regex in the prefilter.
+   * @return true if the prefilter was run and the regex is known not to match the name.
+   */
+  bool prefilterRejects(int prefilter_index) const;
+
 private:
   absl::string_view name_;
   std::vector<absl::string_view> tokens_;
+  std::vector<int> prefilter_matches_;
+  bool has_prefilter_matches_{false};
 };
 
 // To check if a tag extractor is actually used you can run
@@ -141,9 +157,19 @@ public:
   bool extractTag(TagExtractionContext& context, std::vector<Tag>& tags,
                   IntervalSet<size_t>& remove_characters) const override;
 
+  const re2::RE2& regex() const { return regex_; }
+
+  /**
+   * Associates this extractor with a regex in a combined prefilter, so that
+   * extractTag() can skip matching when the prefilter already ruled it out.
+   * @param prefilter_index the index of this extractor's regex in the prefilter.
+   */
+  void setPrefilterIndex(int prefilter_index) { prefilter_index_ = prefilter_index; }
+
 private:
   const re2::RE2 regex_;
   const std::string negative_match_;
+  int prefilter_index_{-1};
 };
 
 /**
@@ -59,6 +59,8 @@ TagProducerImpl::TagProducerImpl(const envoy::config::metrics::v3::StatsConfig&
       fixed_tags_.push_back(Tag{name, tag_specifier.fixed_value()});
     }
   }
+
+  compilePrefilter();
 }
 
 absl::Status TagProducerImpl::addExtractorsMatching(absl::string_view name) {
@@ -95,6 +97,20 @@ void TagProducerImpl::addExtractor(TagExtractorPtr extractor) {
     other.get().setOtherExtractorWithSameNameExists(true);
   }
 
+  // Only RE2 extractors join the prefilter: std::regex syntax is not RE2 syntax, and the token and
+  // fixed extractors are already cheaper than a regex match.
+  auto* re2_extractor = dynamic_cast<TagExtractorRe2Impl*>(extractor.get());
+  if (re2_extractor != nullptr) {
+    if (prefilter_ == nullptr) {
+      prefilter_ = std::make_unique<re2::RE2::Set>(re2::RE2::Options(), re2::RE2::UNANCHORED);
+    }
+    // An invalid regex can never match, so its extractor is left to fail on its own.
+    const int prefilter_index = prefilter_->Add(re2_extractor->regex().pattern(), nullptr);
+    if (prefilter_index >= 0) {
+      re2_extractor->setPrefilterIndex(prefilter_index);
+    }
+  }
+
   const absl::string_view prefix = extractor->prefixToken();
   if (prefix.empty()) {
     tag_extractors_without_prefix_.emplace_back(std::move(extractor));
@@ -121,10 +137,27 @@ void TagProducerImpl::forEachExtractorMatching(
   }
 }
 
+void TagProducerImpl::compilePrefilter() {
+  if (prefilter_ != nullptr && !prefilter_->Compile()) {
+    // Out of memory compiling the combined regex; each extractor falls back to its own regex.
+    ENVOY_LOG_MISC(warn, "Unable to compile the combined tag extractor regexes");
+    prefilter_.reset();
+  }
+}
+
 std::string TagProducerImpl::produceTags(absl::string_view metric_name, TagVector& tags) const {
   // TODO(jmarantz): Skip the creation of string-based tags, creating a StatNameTagVector instead.
   IntervalSetImpl<size_t> remove_characters;
   TagExtractionContext tag_extraction_context(metric_name);
+  if (prefilter_ != nullptr) {
+    std::vector<int> matches;
+    re2::RE2::Set::ErrorInfo error_info;
+    // On a DFA failure, leave the context without matches so every extractor runs its own regex.
+    if (prefilter_->Match(metric_name, &matches, &error_info) ||
+        error_info.kind == re2::RE2::Set::kNoError) {
+      tag_extraction_context.setPrefilterMatches(std::move(matches));
+    }
+  }
   std::vector<absl::string_view> tokens;
   absl::flat_hash_set<absl::string_view> dup_set;
   forEachExtractorMatching(metric_name, [&remove_characters, &tags, &tag_extraction_context,
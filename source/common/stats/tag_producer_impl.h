@@ -18,6 +18,7 @@
 #include "absl/container/flat_hash_map.h"
 #include "absl/container/node_hash_set.h"
 #include "absl/strings/string_view.h"
+#include "re2/set.h"
 
 namespace Envoy {
 namespace Stats {
@@ -104,6 +105,12 @@ private:
   void forEachExtractorMatching(absl::string_view stat_name,
                                 std::function<void(const TagExtractorPtr&)> f) const;
 
+  /**
+   * Compiles the regexes of all RE2-based extractors added so far into prefilter_.
+   * This is called once, after all extractors have been added.
+   */
+  void compilePrefilter();
+
   std::vector<TagExtractorPtr> tag_extractors_without_prefix_;
 
   // Maps a prefix word extracted out of a regex to a vector of TagExtractors. Note that
@@ -118,6 +125,11 @@ private:
   absl::flat_hash_map<absl::string_view, std::reference_wrapper<TagExtractor>> extractor_map_;
 
   TagVector fixed_tags_;
+
+  // Combines the regexes of every RE2-based extractor, default or custom, so that a single DFA
+  // pass over a stat name determines which of them can match. Extractors the prefilter rules out
+  // skip their own capture-extracting match. Null if there are no RE2-based extractors.
+  std::unique_ptr<re2::RE2::Set> prefilter_;
 };
 
 } // namespace Stats
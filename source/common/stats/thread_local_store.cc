@@ -1,5 +1,6 @@
 #include "source/common/stats/thread_local_store.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <list>
@@ -18,6 +19,7 @@
 #include "source/common/stats/tag_producer_impl.h"
 #include "source/common/stats/tag_utility.h"
 
+#include "absl/container/inlined_vector.h"
 #include "absl/strings/str_join.h"
 
 namespace Envoy {
@@ -222,6 +224,9 @@ void ThreadLocalStoreImpl::shutdownThreading() {
     central_cache_entries_to_cleanup_.clear();
   }
 
+  // No merge can be in flight here as merges complete synchronously on the main thread.
+  merge_pool_.reset();
+
   Thread::LockGuard lock(hist_mutex_);
   for (ParentHistogramImpl* histogram : histogram_set_) {
     histogram->setShuttingDown(true);
@@ -248,14 +253,124 @@ void ThreadLocalStoreImpl::mergeHistograms(PostMergeCb merge_complete_cb) {
   }
 }
 
+void ThreadLocalStoreImpl::setHistogramMergeThreads(Thread::ThreadFactory& thread_factory,
+                                                    uint32_t num_threads) {
+  ASSERT(!merge_in_progress_);
+  merge_pool_.reset();
+  if (num_threads > 0) {
+    merge_pool_ = std::make_unique<HistogramMergePool>(thread_factory, num_threads);
+  }
+}
+
 void ThreadLocalStoreImpl::mergeInternal(PostMergeCb merge_complete_cb) {
   if (!shutting_down_) {
-    forEachHistogram(nullptr, [](ParentHistogram& histogram) { histogram.merge(); });
+    if (merge_pool_ == nullptr) {
+      forEachHistogram(nullptr, [](ParentHistogram& histogram) { histogram.merge(); });
+    } else {
+      // Take references under the lock so that the merge itself can run without
+      // blocking histogram creation, and so that no histogram is freed mid-merge.
+      std::vector<ParentHistogramImplSharedPtr> histograms;
+      {
+        Thread::LockGuard lock(hist_mutex_);
+        histograms.reserve(histogram_set_.size());
+        for (ParentHistogramImpl* histogram : histogram_set_) {
+          histograms.emplace_back(histogram);
+        }
+      }
+      merge_pool_->merge(histograms);
+      // Dropping the references may take hist_mutex_, so this must happen after
+      // the lock above has been released.
+    }
     merge_complete_cb();
     merge_in_progress_ = false;
   }
 }
 
+HistogramMergePool::HistogramMergePool(Thread::ThreadFactory& thread_factory,
+                                       uint32_t num_threads) {
+  threads_.reserve(num_threads);
+  for (uint32_t i = 0; i < num_threads; ++i) {
+    threads_.emplace_back(thread_factory.createThread([this]() { threadRoutine(); },
+                                                      Thread::Options{"StatsHistMerge"}));
+  }
+}
+
+HistogramMergePool::~HistogramMergePool() {
+  {
+    Thread::LockGuard lock(mutex_);
+    shutdown_ = true;
+  }
+  work_cond_.notifyAll();
+  for (Thread::ThreadPtr& thread : threads_) {
+    thread->join();
+  }
+}
+
+void HistogramMergePool::merge(const std::vector<ParentHistogramImplSharedPtr>& histograms) {
+  if (histograms.size() <= ShardSize) {
+    // Not worth waking the helpers for a single shard.
+    for (const ParentHistogramImplSharedPtr& histogram : histograms) {
+      histogram->merge();
+    }
+    return;
+  }
+
+  next_shard_ = 0;
+  {
+    Thread::LockGuard lock(mutex_);
+    ASSERT(pending_threads_ == 0);
+    histograms_ = &histograms;
+    pending_threads_ = threads_.size();
+    ++generation_;
+  }
+  work_cond_.notifyAll();
+  mergeShards(histograms);
+
+  // Every helper must observe the generation before we return, as the histogram
+  // vector is owned by the caller.
+  Thread::LockGuard lock(mutex_);
+  while (pending_threads_ > 0) {
+    done_cond_.wait(mutex_);
+  }
+  histograms_ = nullptr;
+}
+
+void HistogramMergePool::threadRoutine() {
+  uint64_t generation = 0;
+  while (true) {
+    const std::vector<ParentHistogramImplSharedPtr>* histograms;
+    {
+      Thread::LockGuard lock(mutex_);
+      while (!shutdown_ && generation_ == generation) {
+        work_cond_.wait(mutex_);
+      }
+      if (shutdown_) {
+        return;
+      }
+      generation = generation_;
+      histograms = histograms_;
+    }
+
+    mergeShards(*histograms);
+
+    Thread::LockGuard lock(mutex_);
+    if (--pending_threads_ == 0) {
+      done_cond_.notifyOne();
+    }
+  }
+}
+
+void HistogramMergePool::mergeShards(const std::vector<ParentHistogramImplSharedPtr>& histograms) {
+  const uint64_t size = histograms.size();
+  for (uint64_t begin = next_shard_.fetch_add(ShardSize); begin < size;
+       begin = next_shard_.fetch_add(ShardSize)) {
+    const uint64_t end = std::min<uint64_t>(begin + ShardSize, size);
+    for (uint64_t i = begin; i < end; ++i) {
+      histograms[i]->merge();
+    }
+  }
+}
+
 ThreadLocalStoreImpl::CentralCacheEntry::~CentralCacheEntry() {
   // Assert that the symbol-table is valid, so we get good test coverage of
   // the validity of the symbol table at the time this destructor runs. This
@@ -503,9 +618,23 @@ StatType& ThreadLocalStoreImpl::ScopeImpl::safeMakeStat(
     }
   }
 
-  // We must now look in the central store so we must be locked. We grab a reference to the
-  // central store location. It might contain nothing. In this case, we allocate a new stat.
+  // We must now look in the central store so we must be locked.
   Thread::LockGuard lock(parent_.lock_);
+  return makeStatLockHeld<StatType>(full_stat_name, name_no_tags, stat_name_tags,
+                                    central_cache_map, fast_reject_result, central_rejected_stats,
+                                    make_stat, tls_cache, tls_rejected_stats, null_stat);
+}
+
+template <class StatType>
+StatType& ThreadLocalStoreImpl::ScopeImpl::makeStatLockHeld(
+    StatName full_stat_name, StatName name_no_tags,
+    const absl::optional<StatNameTagVector>& stat_name_tags,
+    StatNameHashMap<RefcountPtr<StatType>>& central_cache_map,
+    StatsMatcher::FastResult fast_reject_result, StatNameStorageSet& central_rejected_stats,
+    MakeStatFn<StatType> make_stat, StatRefMap<StatType>* tls_cache,
+    StatNameHashSet* tls_rejected_stats, StatType& null_stat) {
+  // We grab a reference to the central store location. It might contain nothing. In this case, we
+  // allocate a new stat.
   auto iter = central_cache_map.find(full_stat_name);
   RefcountPtr<StatType>* central_ref = nullptr;
   if (iter != central_cache_map.end()) {
@@ -743,6 +872,68 @@ TextReadout& ThreadLocalStoreImpl::ScopeImpl::textReadoutFromStatNameWithTags(
       tls_cache, tls_rejected_stats, parent_.null_text_readout_);
 }
 
+void ThreadLocalStoreImpl::ScopeImpl::countersFromStatNames(absl::Span<const StatName> names,
+                                                           absl::Span<Counter*> counters) {
+  ASSERT(names.size() == counters.size());
+  if (parent_.rejectsAll()) {
+    std::fill(counters.begin(), counters.end(), &parent_.null_counter_);
+    return;
+  }
+
+  StatRefMap<Counter>* tls_cache = nullptr;
+  StatNameHashSet* tls_rejected_stats = nullptr;
+  if (!parent_.shutting_down_ && parent_.tls_cache_) {
+    TlsCacheEntry& entry = parent_.tlsCache().insertScope(this->scope_id_);
+    tls_cache = &entry.counters_;
+    tls_rejected_stats = &entry.rejected_stats_;
+  }
+
+  // Serve what we can from the TLS cache as counterFromStatNameWithTags() does, and collect the
+  // misses so that they are all resolved under a single acquisition of lock_.
+  struct Miss {
+    size_t index_;
+    TagUtility::TagStatNameJoiner joiner_;
+    StatsMatcher::FastResult fast_reject_result_;
+  };
+  absl::InlinedVector<Miss, 8> misses;
+  for (size_t i = 0; i < names.size(); ++i) {
+    TagUtility::TagStatNameJoiner joiner(prefix_.statName(), names[i], absl::nullopt,
+                                         symbolTable());
+    const StatName final_stat_name = joiner.nameWithTags();
+    const StatsMatcher::FastResult fast_reject_result = parent_.fastRejects(final_stat_name);
+    if (fast_reject_result == StatsMatcher::FastResult::Rejects ||
+        (tls_rejected_stats != nullptr &&
+         tls_rejected_stats->find(final_stat_name) != tls_rejected_stats->end())) {
+      counters[i] = &parent_.null_counter_;
+      continue;
+    }
+    if (tls_cache != nullptr) {
+      auto pos = tls_cache->find(final_stat_name);
+      if (pos != tls_cache->end()) {
+        counters[i] = &pos->second.get();
+        continue;
+      }
+    }
+    misses.push_back({i, std::move(joiner), fast_reject_result});
+  }
+  if (misses.empty()) {
+    return;
+  }
+
+  Thread::LockGuard lock(parent_.lock_);
+  const CentralCacheEntrySharedPtr& central_cache = centralCacheLockHeld();
+  for (const Miss& miss : misses) {
+    counters[miss.index_] = &makeStatLockHeld<Counter>(
+        miss.joiner_.nameWithTags(), miss.joiner_.tagExtractedName(), absl::nullopt,
+        central_cache->counters_, miss.fast_reject_result_, central_cache->rejected_stats_,
+        [](Allocator& allocator, StatName name, StatName tag_extracted_name,
+           const StatNameTagVector& tags) -> CounterSharedPtr {
+          return allocator.makeCounter(name, tag_extracted_name, tags);
+        },
+        tls_cache, tls_rejected_stats, parent_.null_counter_);
+  }
+}
+
 CounterOptConstRef ThreadLocalStoreImpl::ScopeImpl::findCounter(StatName name) const {
   Thread::LockGuard lock(parent_.lock_);
   return findStatLockHeld<Counter>(name, central_cache_->counters_);
@@ -6,11 +6,14 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "envoy/stats/tag.h"
+#include "envoy/thread/thread.h"
 #include "envoy/thread_local/thread_local.h"
 
 #include "source/common/common/hash.h"
+#include "source/common/common/thread.h"
 #include "source/common/common/thread_synchronizer.h"
 #include "source/common/stats/allocator_impl.h"
 #include "source/common/stats/histogram_impl.h"
@@ -150,6 +153,48 @@ private:
 
 using ParentHistogramImplSharedPtr = RefcountPtr<ParentHistogramImpl>;
 
+/**
+ * A small pool of helper threads used to merge parent histograms in parallel. The
+ * histograms are handed out in fixed-size shards; the calling thread claims shards
+ * alongside the helpers, and merge() returns only once every shard is complete.
+ */
+class HistogramMergePool {
+public:
+  HistogramMergePool(Thread::ThreadFactory& thread_factory, uint32_t num_threads);
+  ~HistogramMergePool();
+
+  /**
+   * Merges each histogram, blocking until all of them have been merged.
+   * @param histograms the histograms to merge.
+   */
+  void merge(const std::vector<ParentHistogramImplSharedPtr>& histograms);
+
+  /**
+   * @return the number of helper threads in the pool.
+   */
+  uint32_t numThreads() const { return threads_.size(); }
+
+  // Number of histograms claimed by a thread at a time. Merging a single histogram
+  // is cheap, so shards amortize the cost of claiming work.
+  static constexpr uint32_t ShardSize = 64;
+
+private:
+  void threadRoutine();
+  void mergeShards(const std::vector<ParentHistogramImplSharedPtr>& histograms);
+
+  Thread::MutexBasicLockable mutex_;
+  Thread::CondVar work_cond_;
+  Thread::CondVar done_cond_;
+  const std::vector<ParentHistogramImplSharedPtr>* histograms_ ABSL_GUARDED_BY(mutex_){};
+  uint64_t generation_ ABSL_GUARDED_BY(mutex_){};
+  uint32_t pending_threads_ ABSL_GUARDED_BY(mutex_){};
+  bool shutdown_ ABSL_GUARDED_BY(mutex_){};
+  std::atomic<uint64_t> next_shard_{};
+  std::vector<Thread::ThreadPtr> threads_;
+};
+
+using HistogramMergePoolPtr = std::unique_ptr<HistogramMergePool>;
+
 /**
  * Store implementation with thread local caching. For design details see
  * https://github.com/envoyproxy/envoy/blob/main/source/docs/stats.md
@@ -199,6 +244,11 @@ public:
                            ThreadLocal::Instance& tls) override;
   void shutdownThreading() override;
   void mergeHistograms(PostMergeCb merge_cb) override;
+  void setHistogramMergeThreads(Thread::ThreadFactory& thread_factory,
+                                uint32_t num_threads) override;
+  void setShardedCounters(const std::vector<std::string>& tag_extracted_names) override {
+    alloc_.setShardedCounters(tag_extracted_names);
+  }
   void deliverHistogramToSinks(const Histogram& histogram, uint64_t value) override;
 
   Histogram& tlsHistogram(ParentHistogramImpl& parent, uint64_t id);
@@ -397,6 +447,20 @@ private:
                            MakeStatFn<StatType> make_stat, StatRefMap<StatType>* tls_cache,
                            StatNameHashSet* tls_rejected_stats, StatType& null_stat);
 
+    /**
+     * The part of safeMakeStat() that runs once the stat has missed the TLS cache: looks it up in
+     * the central cache, or makes it, and inserts it in the TLS cache.
+     */
+    template <class StatType>
+    StatType& makeStatLockHeld(StatName full_stat_name, StatName name_no_tags,
+                               const absl::optional<StatNameTagVector>& stat_name_tags,
+                               StatNameHashMap<RefcountPtr<StatType>>& central_cache_map,
+                               StatsMatcher::FastResult fast_reject_result,
+                               StatNameStorageSet& central_rejected_stats,
+                               MakeStatFn<StatType> make_stat, StatRefMap<StatType>* tls_cache,
+                               StatNameHashSet* tls_rejected_stats, StatType& null_stat)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(parent_.lock_);
+
     template <class StatType>
     using StatTypeOptConstRef = absl::optional<std::reference_wrapper<const StatType>>;
 
@@ -422,6 +486,8 @@ private:
     }
 
     StatName prefix() const override { return prefix_.statName(); }
+    void countersFromStatNames(absl::Span<const StatName> names,
+                               absl::Span<Counter*> counters) override;
 
     // Returns the central cache, asserting that the parent lock is held.
     //
@@ -567,6 +633,9 @@ private:
   StatSet<ParentHistogramImpl> histogram_set_ ABSL_GUARDED_BY(hist_mutex_);
   StatSet<ParentHistogramImpl> sinked_histograms_ ABSL_GUARDED_BY(hist_mutex_);
 
+  // Helper threads for mergeInternal(); null when histograms are merged on the main thread.
+  HistogramMergePoolPtr merge_pool_;
+
   // Retain storage for deleted stats; these are no longer in maps because the
   // matcher-pattern was established after they were created. Since the stats
   // are held by reference in code that expects them to be there, we can't
@@ -0,0 +1,193 @@
+#include "source/common/tcp_proxy/splice_forwarder.h"
+
+#include "envoy/common/platform.h"
+
+#include "source/common/common/assert.h"
+#include "source/common/common/utility.h"
+
+#include "absl/strings/str_cat.h"
+
+#if defined(__linux__)
+#include <fcntl.h>
+
+#include "source/common/api/os_sys_calls_impl_linux.h"
+#endif
+
+namespace Envoy {
+namespace TcpProxy {
+
+#if defined(__linux__)
+
+namespace {
+// The maximum number of times the data is moved through a pipe for a single socket event, so that
+// a fast connection doesn't starve the others on the same dispatcher.
+constexpr uint32_t MaxSplicesPerEvent = 16;
+} // namespace
+
+std::unique_ptr<SpliceForwarder> SpliceForwarder::create(Event::Dispatcher& dispatcher,
+                                                         Network::IoHandle& downstream,
+                                                         Network::IoHandle& upstream,
+                                                         uint32_t pipe_size,
+                                                         SpliceForwarderCallbacks& callbacks) {
+  Network::IoHandlePtr downstream_duplicate = downstream.duplicate();
+  Network::IoHandlePtr upstream_duplicate = upstream.duplicate();
+  if (downstream_duplicate == nullptr || upstream_duplicate == nullptr ||
+      !downstream_duplicate->isOpen() || !upstream_duplicate->isOpen()) {
+    return nullptr;
+  }
+  std::unique_ptr<SpliceForwarder> forwarder(new SpliceForwarder(
+      std::move(downstream_duplicate), std::move(upstream_duplicate), callbacks));
+  if (!forwarder->createPipe(forwarder->downstream_to_upstream_, pipe_size) ||
+      !forwarder->createPipe(forwarder->upstream_to_downstream_, pipe_size)) {
+    return nullptr;
+  }
+
+  SpliceForwarder* raw_forwarder = forwarder.get();
+  forwarder->downstream_->initializeFileEvent(
+      dispatcher,
+      [raw_forwarder](uint32_t events) {
+        raw_forwarder->onFileEvent(false, events);
+        return absl::OkStatus();
+      },
+      Event::PlatformDefaultTriggerType, Event::FileReadyType::Read | Event::FileReadyType::Write);
+  forwarder->upstream_->initializeFileEvent(
+      dispatcher,
+      [raw_forwarder](uint32_t events) {
+        raw_forwarder->onFileEvent(true, events);
+        return absl::OkStatus();
+      },
+      Event::PlatformDefaultTriggerType, Event::FileReadyType::Read | Event::FileReadyType::Write);
+  // Data may have arrived before the forwarder existed, and edge triggered events won't report it.
+  forwarder->downstream_->activateFileEvents(Event::FileReadyType::Read);
+  forwarder->upstream_->activateFileEvents(Event::FileReadyType::Read);
+  return forwarder;
+}
+
+SpliceForwarder::SpliceForwarder(Network::IoHandlePtr&& downstream,
+                                 Network::IoHandlePtr&& upstream,
+                                 SpliceForwarderCallbacks& callbacks)
+    : downstream_(std::move(downstream)), upstream_(std::move(upstream)), callbacks_(callbacks) {
+  downstream_to_upstream_.source_ = downstream_.get();
+  downstream_to_upstream_.sink_ = upstream_.get();
+  upstream_to_downstream_.source_ = upstream_.get();
+  upstream_to_downstream_.sink_ = downstream_.get();
+}
+
+SpliceForwarder::~SpliceForwarder() {
+  auto& os_syscalls = Api::OsSysCallsSingleton::get();
+  for (Direction* direction : {&downstream_to_upstream_, &upstream_to_downstream_}) {
+    if (direction->pipe_read_fd_ != -1) {
+      os_syscalls.close(direction->pipe_read_fd_);
+      os_syscalls.close(direction->pipe_write_fd_);
+    }
+  }
+}
+
+bool SpliceForwarder::createPipe(Direction& direction, uint32_t pipe_size) {
+  auto& os_syscalls = Api::LinuxOsSysCallsSingleton::get();
+  int fds[2];
+  const Api::SysCallIntResult result = os_syscalls.pipe2(fds, O_NONBLOCK | O_CLOEXEC);
+  if (result.return_value_ != 0) {
+    ENVOY_LOG(debug, "unable to create a splice pipe: {}", errorDetails(result.errno_));
+    return false;
+  }
+  direction.pipe_read_fd_ = fds[0];
+  direction.pipe_write_fd_ = fds[1];
+  if (pipe_size > 0) {
+    // The kernel rounds the size up, and may refuse it if it exceeds the unprivileged limit. The
+    // default capacity is used in that case.
+    os_syscalls.fcntl(direction.pipe_write_fd_, F_SETPIPE_SZ, static_cast<int>(pipe_size));
+  }
+  const Api::SysCallIntResult capacity =
+      os_syscalls.fcntl(direction.pipe_write_fd_, F_GETPIPE_SZ, 0);
+  if (capacity.return_value_ <= 0) {
+    return false;
+  }
+  direction.pipe_capacity_ = capacity.return_value_;
+  return true;
+}
+
+void SpliceForwarder::onFileEvent(bool upstream, uint32_t events) {
+  // Reads from a socket fill the pipe towards its peer, and writes to it drain the pipe from its
+  // peer.
+  if (events & Event::FileReadyType::Read) {
+    if (!forward(upstream ? upstream_to_downstream_ : downstream_to_upstream_)) {
+      return;
+    }
+  }
+  if (events & Event::FileReadyType::Write) {
+    forward(upstream ? downstream_to_upstream_ : upstream_to_downstream_);
+  }
+}
+
+bool SpliceForwarder::forward(Direction& direction) {
+  auto& os_syscalls = Api::LinuxOsSysCallsSingleton::get();
+  for (uint32_t i = 0; i < MaxSplicesPerEvent; ++i) {
+    bool progress = false;
+
+    if (!direction.read_end_stream_ && direction.pipe_length_ < direction.pipe_capacity_) {
+      const Api::SysCallSizeResult result = os_syscalls.splice(
+          direction.source_->fdDoNotUse(), direction.pipe_write_fd_,
+          direction.pipe_capacity_ - direction.pipe_length_, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+      if (result.return_value_ > 0) {
+        direction.pipe_length_ += result.return_value_;
+        callbacks_.onSpliceRead(direction.from_upstream_, result.return_value_);
+        progress = true;
+      } else if (result.return_value_ == 0) {
+        direction.read_end_stream_ = true;
+        progress = true;
+      } else if (result.errno_ != SOCKET_ERROR_AGAIN) {
+        callbacks_.onSpliceError(absl::StrCat("splice read failed: ", errorDetails(result.errno_)));
+        return false;
+      }
+    }
+
+    if (direction.pipe_length_ > 0) {
+      const Api::SysCallSizeResult result =
+          os_syscalls.splice(direction.pipe_read_fd_, direction.sink_->fdDoNotUse(),
+                             direction.pipe_length_, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+      if (result.return_value_ > 0) {
+        direction.pipe_length_ -= result.return_value_;
+        callbacks_.onSpliceWrite(!direction.from_upstream_, result.return_value_);
+        progress = true;
+      } else if (result.return_value_ < 0 && result.errno_ != SOCKET_ERROR_AGAIN) {
+        callbacks_.onSpliceError(
+            absl::StrCat("splice write failed: ", errorDetails(result.errno_)));
+        return false;
+      }
+    }
+
+    if (direction.read_end_stream_ && direction.pipe_length_ == 0 &&
+        !direction.write_end_stream_) {
+      // Forward the half close.
+      direction.write_end_stream_ = true;
+      direction.sink_->shutdown(ENVOY_SHUT_WR);
+      if (downstream_to_upstream_.write_end_stream_ && upstream_to_downstream_.write_end_stream_) {
+        callbacks_.onSpliceEndStream();
+        return false;
+      }
+    }
+
+    if (!progress) {
+      return true;
+    }
+  }
+  // Yield to the other events, and continue in the next event loop iteration.
+  direction.source_->activateFileEvents(Event::FileReadyType::Read);
+  return true;
+}
+
+#else
+
+std::unique_ptr<SpliceForwarder> SpliceForwarder::create(Event::Dispatcher&, Network::IoHandle&,
+                                                         Network::IoHandle&, uint32_t,
+                                                         SpliceForwarderCallbacks&) {
+  return nullptr;
+}
+
+SpliceForwarder::~SpliceForwarder() = default;
+
+#endif
+
+} // namespace TcpProxy
+} // namespace Envoy
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "envoy/common/pure.h"
+#include "envoy/event/dispatcher.h"
+#include "envoy/network/io_handle.h"
+
+#include "source/common/common/logger.h"
+
+#include "absl/strings/string_view.h"
+
+namespace Envoy {
+namespace TcpProxy {
+
+/**
+ * Callbacks invoked by a SpliceForwarder.
+ */
+class SpliceForwarderCallbacks {
+public:
+  virtual ~SpliceForwarderCallbacks() = default;
+
+  /**
+   * Called when bytes were read from one of the sockets.
+   * @param from_upstream whether the bytes were read from the upstream socket.
+   * @param bytes supplies the number of bytes read.
+   */
+  virtual void onSpliceRead(bool from_upstream, uint64_t bytes) PURE;
+
+  /**
+   * Called when bytes were written to one of the sockets.
+   * @param to_upstream whether the bytes were written to the upstream socket.
+   * @param bytes supplies the number of bytes written.
+   */
+  virtual void onSpliceWrite(bool to_upstream, uint64_t bytes) PURE;
+
+  /**
+   * Called once both sockets reached end of stream and all the data read from them has been
+   * written. The forwarder may be destroyed from this callback.
+   */
+  virtual void onSpliceEndStream() PURE;
+
+  /**
+   * Called when reading or writing one of the sockets failed, e.g. because the peer reset the
+   * connection. No more data is forwarded. The forwarder may be destroyed from this callback.
+   * @param details supplies a description of the failure.
+   */
+  virtual void onSpliceError(absl::string_view details) PURE;
+};
+
+/**
+ * Forwards the data between two connected TCP sockets in the kernel with splice(2), through a pipe
+ * per direction, without copying it to user space. The forwarder works on duplicates of the
+ * sockets' file descriptors, so the sockets stay open until both their owner and the forwarder
+ * have closed them. Pipes are bounded, so a slow writer stops the reads from its peer exactly like
+ * a connection buffer above its high watermark. Only supported on Linux.
+ */
+class SpliceForwarder : Logger::Loggable<Logger::Id::filter> {
+public:
+  /**
+   * @param dispatcher supplies the dispatcher the sockets' events are processed on.
+   * @param downstream supplies the downstream socket.
+   * @param upstream supplies the upstream socket.
+   * @param pipe_size supplies the requested capacity of each pipe, or 0 for the system default.
+   * @param callbacks supplies the callbacks to invoke, which must outlive the forwarder.
+   * @return the forwarder, or nullptr if splicing is not supported or the pipes can't be created.
+   */
+  static std::unique_ptr<SpliceForwarder> create(Event::Dispatcher& dispatcher,
+                                                 Network::IoHandle& downstream,
+                                                 Network::IoHandle& upstream, uint32_t pipe_size,
+                                                 SpliceForwarderCallbacks& callbacks);
+
+  ~SpliceForwarder();
+
+private:
+  // One direction of the forwarding, from the source socket through the pipe to the sink socket.
+  struct Direction {
+    Direction(bool from_upstream) : from_upstream_(from_upstream) {}
+
+    const bool from_upstream_;
+    Network::IoHandle* source_{};
+    Network::IoHandle* sink_{};
+    int pipe_read_fd_{-1};
+    int pipe_write_fd_{-1};
+    uint64_t pipe_capacity_{};
+    // The number of bytes read from the source which are still in the pipe.
+    uint64_t pipe_length_{};
+    bool read_end_stream_{};
+    bool write_end_stream_{};
+  };
+
+  SpliceForwarder(Network::IoHandlePtr&& downstream, Network::IoHandlePtr&& upstream,
+                  SpliceForwarderCallbacks& callbacks);
+
+  bool createPipe(Direction& direction, uint32_t pipe_size);
+  void onFileEvent(bool upstream, uint32_t events);
+  // Moves data through the pipe of the direction until neither side can make progress. Returns
+  // false if a callback which may have destroyed the forwarder was invoked.
+  bool forward(Direction& direction);
+
+  Network::IoHandlePtr downstream_;
+  Network::IoHandlePtr upstream_;
+  SpliceForwarderCallbacks& callbacks_;
+  Direction downstream_to_upstream_{false};
+  Direction upstream_to_downstream_{true};
+};
+
+using SpliceForwarderPtr = std::unique_ptr<SpliceForwarder>;
+
+} // namespace TcpProxy
+} // namespace Envoy
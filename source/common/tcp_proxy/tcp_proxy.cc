@@ -27,7 +27,9 @@
 #include "source/common/config/utility.h"
 #include "source/common/config/well_known_names.h"
 #include "source/common/network/application_protocol.h"
+#include "source/common/network/connection_impl.h"
 #include "source/common/network/proxy_protocol_filter_state.h"
+#include "source/common/network/raw_buffer_socket.h"
 #include "source/common/network/socket_option_factory.h"
 #include "source/common/network/transport_socket_options_impl.h"
 #include "source/common/network/upstream_server_name.h"
@@ -114,7 +116,7 @@ Config::SharedConfig::SharedConfig(
     const envoy::extensions::filters::network::tcp_proxy::v3::TcpProxy& config,
     Server::Configuration::FactoryContext& context)
     : stats_scope_(context.scope().createScope(fmt::format("tcp.{}", config.stat_prefix()))),
-      stats_(generateStats(*stats_scope_)) {
+      stats_(generateStats(*stats_scope_)), splice_forwarding_(config.splice_forwarding()) {
   if (config.has_idle_timeout()) {
     const uint64_t timeout = DurationUtil::durationToMilliseconds(config.idle_timeout());
     if (timeout > 0) {
@@ -339,6 +341,7 @@ void Filter::initialize(Network::ReadFilterCallbacks& callbacks, bool set_connec
 
   config_->stats().downstream_cx_total_.inc();
   if (set_connection_stats) {
+    connection_stats_set_ = true;
     read_callbacks_->connection().setConnectionStats(
         {config_->stats().downstream_cx_rx_bytes_total_,
          config_->stats().downstream_cx_rx_bytes_buffered_,
@@ -899,6 +902,7 @@ void Filter::onDownstreamEvent(Network::ConnectionEvent event) {
     downstream_closed_ = true;
     // Cancel the potential odcds callback.
     cluster_discovery_handle_ = nullptr;
+    splice_forwarder_.reset();
   }
 
   ENVOY_CONN_LOG(trace, "on downstream event {}, has upstream = {}", read_callbacks_->connection(),
@@ -949,6 +953,7 @@ void Filter::onUpstreamEvent(Network::ConnectionEvent event) {
 
   if (event == Network::ConnectionEvent::RemoteClose ||
       event == Network::ConnectionEvent::LocalClose) {
+    splice_forwarder_.reset();
     if (Runtime::runtimeFeatureEnabled(
             "envoy.restart_features.upstream_http_filters_with_tcp_proxy")) {
       read_callbacks_->connection().dispatcher().deferredDelete(std::move(upstream_));
@@ -1062,6 +1067,95 @@ void Filter::onUpstreamConnection() {
   if (config_->flushAccessLogOnConnected()) {
     flushAccessLog(AccessLog::AccessLogType::TcpUpstreamConnected);
   }
+
+  if (config_->spliceForwarding()) {
+    maybeStartSplice();
+  }
+}
+
+namespace {
+// Returns the connection if it moves the payload to and from its socket unmodified and has nothing
+// buffered yet, nullptr otherwise.
+Network::ConnectionImpl* spliceableConnection(Network::Connection& connection) {
+  auto* connection_impl = dynamic_cast<Network::ConnectionImpl*>(&connection);
+  if (connection_impl == nullptr || connection_impl->state() != Network::Connection::State::Open ||
+      dynamic_cast<Network::RawBufferSocket*>(connection_impl->transportSocket().get()) ==
+          nullptr ||
+      connection_impl->getReadBuffer().buffer.length() != 0 ||
+      connection_impl->getReadBuffer().end_stream || connection_impl->bufferedWriteLength() != 0) {
+    return nullptr;
+  }
+  return connection_impl;
+}
+} // namespace
+
+void Filter::maybeStartSplice() {
+  auto* tcp_upstream = dynamic_cast<TcpUpstream*>(upstream_.get());
+  if (tcp_upstream == nullptr || receive_before_connect_) {
+    return;
+  }
+  Network::ConnectionImpl* downstream = spliceableConnection(read_callbacks_->connection());
+  Network::ConnectionImpl* upstream = spliceableConnection(tcp_upstream->connection());
+  if (downstream == nullptr || upstream == nullptr) {
+    return;
+  }
+
+  splice_forwarder_ =
+      SpliceForwarder::create(downstream->dispatcher(), downstream->ioHandle(),
+                              upstream->ioHandle(), downstream->bufferLimit(), *this);
+  if (splice_forwarder_ == nullptr) {
+    return;
+  }
+
+  ENVOY_CONN_LOG(debug, "forwarding the payload with splice", *downstream);
+  config_->stats().splice_forwarding_total_.inc();
+  // The connections stay open to own the sockets and report the close events, but the forwarder
+  // consumes the payload and the end of stream, which must not be detected as an early close.
+  downstream->detectEarlyCloseWhenReadDisabled(false);
+  upstream->detectEarlyCloseWhenReadDisabled(false);
+  downstream->readDisable(true);
+  upstream->readDisable(true);
+}
+
+void Filter::onSpliceRead(bool from_upstream, uint64_t bytes) {
+  if (from_upstream) {
+    getStreamInfo().getUpstreamBytesMeter()->addWireBytesReceived(bytes);
+    read_callbacks_->upstreamHost()->cluster().trafficStats()->upstream_cx_rx_bytes_total_.add(
+        bytes);
+  } else {
+    getStreamInfo().addBytesReceived(bytes);
+    getStreamInfo().getDownstreamBytesMeter()->addWireBytesReceived(bytes);
+    if (connection_stats_set_) {
+      config_->stats().downstream_cx_rx_bytes_total_.add(bytes);
+    }
+  }
+  resetIdleTimer();
+}
+
+void Filter::onSpliceWrite(bool to_upstream, uint64_t bytes) {
+  if (to_upstream) {
+    getStreamInfo().getUpstreamBytesMeter()->addWireBytesSent(bytes);
+    read_callbacks_->upstreamHost()->cluster().trafficStats()->upstream_cx_tx_bytes_total_.add(
+        bytes);
+  } else {
+    getStreamInfo().addBytesSent(bytes);
+    getStreamInfo().getDownstreamBytesMeter()->addWireBytesSent(bytes);
+    if (connection_stats_set_) {
+      config_->stats().downstream_cx_tx_bytes_total_.add(bytes);
+    }
+  }
+  resetIdleTimer();
+}
+
+void Filter::onSpliceEndStream() {
+  ENVOY_CONN_LOG(debug, "spliced connection ended", read_callbacks_->connection());
+  // This results in also closing the upstream connection.
+  read_callbacks_->connection().close(Network::ConnectionCloseType::FlushWrite);
+}
+
+void Filter::onSpliceError(absl::string_view details) {
+  ENVOY_CONN_LOG(debug, "spliced connection failed: {}", read_callbacks_->connection(), details);
+  read_callbacks_->connection().close(Network::ConnectionCloseType::NoFlush);
 }
 
 void Filter::onIdleTimeout() {
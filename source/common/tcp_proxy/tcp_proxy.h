@@ -33,6 +33,7 @@
 #include "source/common/network/hash_policy.h"
 #include "source/common/network/utility.h"
 #include "source/common/stream_info/stream_info_impl.h"
+#include "source/common/tcp_proxy/splice_forwarder.h"
 #include "source/common/tcp_proxy/upstream.h"
 #include "source/common/upstream/load_balancer_context_base.h"
 #include "source/common/upstream/od_cds_api_impl.h"
@@ -67,6 +68,7 @@ constexpr absl::string_view ReceiveBeforeConnectKey = "envoy.tcp_proxy.receive_b
   COUNTER(early_data_received_count_total)                                                         \
   COUNTER(idle_timeout)                                                                            \
   COUNTER(max_downstream_connection_duration)                                                      \
+  COUNTER(splice_forwarding_total)                                                                 \
   COUNTER(upstream_flush_total)                                                                    \
   GAUGE(downstream_cx_rx_bytes_buffered, Accumulate)                                               \
   GAUGE(downstream_cx_tx_bytes_buffered, Accumulate)                                               \
@@ -248,6 +250,7 @@ public:
     const Network::ProxyProtocolTLVVector& proxyProtocolTLVs() const {
       return proxy_protocol_tlvs_;
     }
+    bool spliceForwarding() const { return splice_forwarding_; }
 
   private:
     static TcpProxyStats generateStats(Stats::Scope& scope);
@@ -268,6 +271,7 @@ public:
     std::unique_ptr<OnDemandConfig> on_demand_config_;
     BackOffStrategyPtr backoff_strategy_;
     Network::ProxyProtocolTLVVector proxy_protocol_tlvs_;
+    const bool splice_forwarding_;
   };
 
   using SharedConfigSharedPtr = std::shared_ptr<SharedConfig>;
@@ -326,6 +330,7 @@ public:
   const Network::ProxyProtocolTLVVector& proxyProtocolTLVs() const {
     return shared_config_->proxyProtocolTLVs();
   }
+  bool spliceForwarding() const { return shared_config_->spliceForwarding(); }
 
 private:
   struct SimpleRouteImpl : public Route {
@@ -405,7 +410,8 @@ private:
 class Filter : public Network::ReadFilter,
                public Upstream::LoadBalancerContextBase,
                protected Logger::Loggable<Logger::Id::filter>,
-               public GenericConnectionPoolCallbacks {
+               public GenericConnectionPoolCallbacks,
+               protected SpliceForwarderCallbacks {
 public:
   Filter(ConfigSharedPtr config, Upstream::ClusterManager& cluster_manager);
   ~Filter() override;
@@ -631,6 +637,9 @@ protected:
   void onUpstreamData(Buffer::Instance& data, bool end_stream);
   void onUpstreamEvent(Network::ConnectionEvent event);
   void onUpstreamConnection();
+  // Moves the forwarding of the payload to a SpliceForwarder if it is enabled and both
+  // connections qualify.
+  void maybeStartSplice();
   void onIdleTimeout();
   void resetIdleTimer();
   void disableIdleTimer();
@@ -643,6 +652,12 @@ protected:
   void enableRetryTimer();
   void disableRetryTimer();
 
+  // SpliceForwarderCallbacks
+  void onSpliceRead(bool from_upstream, uint64_t bytes) override;
+  void onSpliceWrite(bool to_upstream, uint64_t bytes) override;
+  void onSpliceEndStream() override;
+  void onSpliceError(absl::string_view details) override;
+
   const ConfigSharedPtr config_;
   Upstream::ClusterManager& cluster_manager_;
   Network::ReadFilterCallbacks* read_callbacks_{};
@@ -684,8 +699,11 @@ protected:
   // the upstream connection is established.
   bool receive_before_connect_{false};
   bool early_data_end_stream_{false};
+  bool connection_stats_set_{false};
   Buffer::OwnedImpl early_data_buffer_{};
   HttpStreamDecoderFilterCallbacks upstream_decoder_filter_callbacks_;
+  // Set while the payload is forwarded in the kernel, see maybeStartSplice().
+  SpliceForwarderPtr splice_forwarder_;
 };
 
 // This class deals with an upstream connection that needs to finish flushing, when the downstream
@@ -178,6 +178,8 @@ public:
   bool startUpstreamSecureTransport() override;
   Ssl::ConnectionInfoConstSharedPtr getUpstreamConnectionSslInfo() override;
 
+  Network::ClientConnection& connection() { return upstream_conn_data_->connection(); }
+
 private:
   Tcp::ConnectionPool::ConnectionDataPtr upstream_conn_data_;
 };
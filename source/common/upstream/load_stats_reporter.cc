@@ -91,10 +91,16 @@ void LoadStatsReporter::sendLoadStatsRequest() {
         locality_stats.set_priority(host_set->priority());
 
         for (const HostSharedPtr& host : hosts) {
-          uint64_t host_rq_success = host->stats().rq_success_.latch();
-          uint64_t host_rq_error = host->stats().rq_error_.latch();
-          uint64_t host_rq_active = host->stats().rq_active_.value();
-          uint64_t host_rq_issued = host->stats().rq_total_.latch();
+          // A host whose stats were never allocated has not seen any requests, so it has no load
+          // stats updates. Skip it without allocating them.
+          HostStats* host_stats = host->statsIfAllocated();
+          if (host_stats == nullptr) {
+            continue;
+          }
+          uint64_t host_rq_success = host_stats->rq_success_.latch();
+          uint64_t host_rq_error = host_stats->rq_error_.latch();
+          uint64_t host_rq_active = host_stats->rq_active_.value();
+          uint64_t host_rq_issued = host_stats->rq_total_.latch();
 
           // Check if the host has any load stats updates. If the host has no load stats updates, we
           // skip it.
@@ -259,9 +265,12 @@ void LoadStatsReporter::startLoadReportPeriod() {
     auto& cluster = it->second.get();
     for (auto& host_set : cluster.prioritySet().hostSetsPerPriority()) {
       for (const auto& host : host_set->hosts()) {
-        host->stats().rq_success_.latch();
-        host->stats().rq_error_.latch();
-        host->stats().rq_total_.latch();
+        HostStats* host_stats = host->statsIfAllocated();
+        if (host_stats != nullptr) {
+          host_stats->rq_success_.latch();
+          host_stats->rq_error_.latch();
+          host_stats->rq_total_.latch();
+        }
       }
     }
     cluster.info()->loadReportStats().upstream_rq_dropped_.latch();
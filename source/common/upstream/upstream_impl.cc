@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <functional>
 #include <limits>
 #include <list>
 #include <memory>
@@ -501,6 +502,24 @@ HostDescriptionImplBase::HostDescriptionImplBase(
   }
 }
 
+HostStats& HostDescriptionImplBase::allocateStats() const {
+  auto stats = std::make_unique<HostStats>();
+  HostStats* expected = nullptr;
+  if (stats_.compare_exchange_strong(expected, stats.get(), std::memory_order_acq_rel)) {
+    return *stats.release();
+  }
+  // Another thread allocated the stats first.
+  return *expected;
+}
+
+HostStats& HostDescriptionImplBase::statsForRead() const {
+  HostStats* stats = stats_.load(std::memory_order_acquire);
+  if (stats != nullptr) {
+    return *stats;
+  }
+  MUTABLE_CONSTRUCT_ON_FIRST_USE(HostStats);
+}
+
 HostDescription::SharedConstAddressVector HostDescriptionImplBase::makeAddressListOrNull(
     const Network::Address::InstanceConstSharedPtr& address, const AddressVector& address_list) {
   if (!address || address_list.empty()) {
@@ -1204,6 +1223,8 @@ ClusterInfoImpl::ClusterInfoImpl(
           std::chrono::milliseconds(PROTOBUF_GET_MS_OR_DEFAULT(config, connect_timeout, 5000))),
       per_upstream_preconnect_ratio_(PROTOBUF_GET_WRAPPED_OR_DEFAULT(
           config.preconnect_policy(), per_upstream_preconnect_ratio, 1.0)),
+      adaptive_preconnect_window_(
+          PROTOBUF_GET_OPTIONAL_MS(config.preconnect_policy(), adaptive_preconnect_window)),
       peekahead_ratio_(PROTOBUF_GET_WRAPPED_OR_DEFAULT(config.preconnect_policy(),
                                                        predictive_preconnect_ratio, 0)),
       socket_matcher_(std::move(socket_matcher)), stats_scope_(std::move(stats_scope)),
@@ -1722,6 +1743,42 @@ bool excludeBasedOnHealthFlag(const Host& host) {
          host.healthFlagGet(Host::HealthFlag::EDS_STATUS_DRAINING);
 }
 
+// Rebuilds one partition of a host set, and its per locality counterpart, if its membership no
+// longer matches the predicate. As partitionHostList() keeps the order of HostSet::hosts(), this
+// is a single pass over the hosts that allocates nothing unless the partition changed. Returns
+// whether the partition was rebuilt.
+template <class PartitionVector>
+bool repartitionIfChanged(const HostSet& host_set,
+                          const std::function<bool(const Host&)>& predicate,
+                          std::shared_ptr<const PartitionVector>& partition,
+                          HostsPerLocalityConstSharedPtr& partition_per_locality) {
+  const HostVector& current = partition->get();
+  size_t next_member = 0;
+  bool changed = false;
+  for (const HostSharedPtr& host : host_set.hosts()) {
+    if (predicate(*host)) {
+      if (next_member == current.size() || current[next_member] != host) {
+        changed = true;
+        break;
+      }
+      ++next_member;
+    }
+  }
+  if (!changed && next_member == current.size()) {
+    return false;
+  }
+
+  auto rebuilt = std::make_shared<PartitionVector>();
+  for (const HostSharedPtr& host : host_set.hosts()) {
+    if (predicate(*host)) {
+      rebuilt->get().emplace_back(host);
+    }
+  }
+  partition = std::move(rebuilt);
+  partition_per_locality = host_set.hostsPerLocality().filter({predicate})[0];
+  return true;
+}
+
 } // namespace
 
 std::tuple<HealthyHostVectorConstSharedPtr, DegradedHostVectorConstSharedPtr,
@@ -1758,6 +1815,25 @@ ClusterImplBase::partitionHostsPerLocality(const HostsPerLocality& hosts) {
                          std::move(filtered_clones[2]));
 }
 
+absl::optional<PrioritySet::UpdateHostsParams>
+ClusterImplBase::repartitionHostsIfChanged(const HostSet& host_set) {
+  PrioritySet::UpdateHostsParams params = HostSetImpl::updateHostsParams(host_set);
+  // Every partition is checked, as a single health change may move a host between several.
+  const bool healthy_changed = repartitionIfChanged(
+      host_set, [](const Host& host) { return host.coarseHealth() == Host::Health::Healthy; },
+      params.healthy_hosts, params.healthy_hosts_per_locality);
+  const bool degraded_changed = repartitionIfChanged(
+      host_set, [](const Host& host) { return host.coarseHealth() == Host::Health::Degraded; },
+      params.degraded_hosts, params.degraded_hosts_per_locality);
+  const bool excluded_changed = repartitionIfChanged(
+      host_set, [](const Host& host) { return excludeBasedOnHealthFlag(host); },
+      params.excluded_hosts, params.excluded_hosts_per_locality);
+  if (!healthy_changed && !degraded_changed && !excluded_changed) {
+    return absl::nullopt;
+  }
+  return params;
+}
+
 bool ClusterInfoImpl::maintenanceMode() const {
   return runtime_.snapshot().featureEnabled(maintenance_mode_runtime_key_, 0);
 }
@@ -1931,10 +2007,25 @@ void ClusterImplBase::reloadHealthyHosts(const HostSharedPtr& host) {
   reloadHealthyHostsHelper(host);
 }
 
-void ClusterImplBase::reloadHealthyHostsHelper(const HostSharedPtr&) {
+void ClusterImplBase::reloadHealthyHostsHelper(const HostSharedPtr& host) {
   const auto& host_sets = prioritySet().hostSetsPerPriority();
   for (size_t priority = 0; priority < host_sets.size(); ++priority) {
     const auto& host_set = host_sets[priority];
+    if (host != nullptr) {
+      // A single host changed health. Only rebuild the partitions whose membership changed, so
+      // that a health flip in a large cluster does not rebuild all of its host vectors. Every
+      // priority is checked, as exclusion flags such as EXCLUDED_VIA_IMMEDIATE_HC_FAIL may have
+      // been set on other hosts without a reload.
+      absl::optional<PrioritySet::UpdateHostsParams> update_hosts_params =
+          repartitionHostsIfChanged(*host_set);
+      if (update_hosts_params.has_value()) {
+        prioritySet().updateHosts(priority, std::move(update_hosts_params.value()),
+                                  host_set->localityWeights(), {}, {}, random_.random(),
+                                  absl::nullopt, absl::nullopt);
+      }
+      continue;
+    }
+
     // TODO(htuch): Can we skip these copies by exporting out const shared_ptr from HostSet?
     HostVectorConstSharedPtr hosts_copy = std::make_shared<HostVector>(host_set->hosts());
 
@@ -2305,6 +2396,26 @@ void PriorityStateManager::updateClusterPrioritySet(
   }
 }
 
+void PriorityStateManager::updateClusterPrioritySetInPlace(const uint32_t priority) {
+  const HostSet& host_set = *parent_.prioritySet().hostSetsPerPriority()[priority];
+  absl::optional<PrioritySet::UpdateHostsParams> update_hosts_params =
+      ClusterImplBase::repartitionHostsIfChanged(host_set);
+  if (!update_hosts_params.has_value()) {
+    // Only weights or metadata changed. The update is still made so that load balancers rebuild.
+    update_hosts_params = HostSetImpl::updateHostsParams(host_set);
+  }
+
+  if (update_cb_ != nullptr) {
+    update_cb_->updateHosts(priority, std::move(update_hosts_params.value()),
+                            host_set.localityWeights(), {}, {}, random_.random(), absl::nullopt,
+                            absl::nullopt);
+  } else {
+    parent_.prioritySet().updateHosts(priority, std::move(update_hosts_params.value()),
+                                      host_set.localityWeights(), {}, {}, random_.random(),
+                                      absl::nullopt, absl::nullopt);
+  }
+}
+
 bool BaseDynamicClusterImpl::updateDynamicHostList(
     const HostVector& new_hosts, HostVector& current_priority_hosts,
     HostVector& hosts_added_to_current_priority, HostVector& hosts_removed_from_current_priority,
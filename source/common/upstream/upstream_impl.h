@@ -195,7 +195,8 @@ public:
   }
 
   bool canCreateConnection(Upstream::ResourcePriority priority) const override {
-    if (stats().cx_active_.value() >= cluster().resourceManager(priority).maxConnectionsPerHost()) {
+    if (statsForRead().cx_active_.value() >=
+        cluster().resourceManager(priority).maxConnectionsPerHost()) {
       return false;
     }
     return cluster().resourceManager(priority).connections().canCreate();
@@ -209,7 +210,11 @@ public:
     static DetectorHostMonitorNullImpl* null_outlier_detector = new DetectorHostMonitorNullImpl();
     return *null_outlier_detector;
   }
-  HostStats& stats() const override { return stats_; }
+  HostStats& stats() const override {
+    HostStats* stats = stats_.load(std::memory_order_acquire);
+    return stats != nullptr ? *stats : allocateStats();
+  }
+  HostStats* statsIfAllocated() const override { return stats_.load(std::memory_order_acquire); }
   LoadMetricStats& loadMetricStats() const override { return load_metric_stats_; }
   const std::string& hostnameForHealthChecks() const override { return health_checks_hostname_; }
   const std::string& hostname() const override { return hostname_; }
@@ -245,6 +250,8 @@ public:
   }
 
 protected:
+  ~HostDescriptionImplBase() override { delete stats_.load(); }
+
   HostDescriptionImplBase(
       ClusterInfoConstSharedPtr cluster, const std::string& hostname,
       Network::Address::InstanceConstSharedPtr dest_address,
@@ -260,7 +267,15 @@ protected:
   makeAddressListOrNull(const Network::Address::InstanceConstSharedPtr& address,
                         const AddressVector& address_list);
 
+  /**
+   * @return the host stats for reading, without allocating them. Hosts whose stats have not been
+   *         allocated share a single zeroed HostStats, which must not be written to.
+   */
+  HostStats& statsForRead() const;
+
 private:
+  HostStats& allocateStats() const;
+
   ClusterInfoConstSharedPtr cluster_;
   const std::string hostname_;
   const std::string health_checks_hostname_;
@@ -270,7 +285,9 @@ private:
   const MetadataConstSharedPtr locality_metadata_;
   const envoy::config::core::v3::Locality locality_;
   Stats::StatNameDynamicStorage locality_zone_stat_name_;
-  mutable HostStats stats_;
+  // Most hosts of large clusters see little or no traffic, so HostStats is only allocated on the
+  // first call to stats(). Hosts may be written from any worker, so this is set with a CAS.
+  mutable std::atomic<HostStats*> stats_{nullptr};
   mutable LoadMetricStatsImpl load_metric_stats_;
   Outlier::DetectorHostMonitorPtr outlier_detector_;
   HealthCheckHostMonitorPtr health_checker_;
@@ -350,7 +367,7 @@ public:
   // Upstream::Host
   std::vector<std::pair<absl::string_view, Stats::PrimitiveCounterReference>>
   counters() const override {
-    return stats().counters();
+    return statsForRead().counters();
   }
   CreateConnectionData createConnection(
       Event::Dispatcher& dispatcher, const Network::ConnectionSocket::OptionsSharedPtr& options,
@@ -362,7 +379,7 @@ public:
 
   std::vector<std::pair<absl::string_view, Stats::PrimitiveGaugeReference>>
   gauges() const override {
-    return stats().gauges();
+    return statsForRead().gauges();
   }
   void healthFlagClear(HealthFlag flag) override { health_flags_ &= ~enumToInt(flag); }
   bool healthFlagGet(HealthFlag flag) const override { return health_flags_ & enumToInt(flag); }
@@ -894,6 +911,9 @@ public:
   }
 
   float perUpstreamPreconnectRatio() const override { return per_upstream_preconnect_ratio_; }
+  const absl::optional<std::chrono::milliseconds> adaptivePreconnectWindow() const override {
+    return adaptive_preconnect_window_;
+  }
   float peekaheadRatio() const override { return peekahead_ratio_; }
   uint32_t perConnectionBufferLimitBytes() const override {
     return per_connection_buffer_limit_bytes_;
@@ -1113,6 +1133,7 @@ private:
   const std::chrono::milliseconds connect_timeout_;
   OptionalTimeouts optional_timeouts_;
   const float per_upstream_preconnect_ratio_;
+  const absl::optional<std::chrono::milliseconds> adaptive_preconnect_window_;
   const float peekahead_ratio_;
   TransportSocketMatcherPtr socket_matcher_;
   Stats::ScopeSharedPtr stats_scope_;
@@ -1221,6 +1242,13 @@ public:
   static std::tuple<HostsPerLocalityConstSharedPtr, HostsPerLocalityConstSharedPtr,
                     HostsPerLocalityConstSharedPtr>
   partitionHostsPerLocality(const HostsPerLocality& hosts);
+
+  // Computes the update params for a host set after the health of some of its hosts changed,
+  // without a change to the hosts themselves. Only the healthy, degraded or excluded partitions
+  // whose membership changed are rebuilt; all other vectors are shared with the current host set.
+  // Returns absl::nullopt if no partition changed, in which case no update is needed.
+  static absl::optional<PrioritySet::UpdateHostsParams>
+  repartitionHostsIfChanged(const HostSet& host_set);
   Config::ConstMetadataSharedPoolSharedPtr constMetadataSharedPool() {
     return const_metadata_shared_pool_;
   }
@@ -1347,6 +1375,12 @@ public:
                            absl::optional<bool> weighted_priority_health = absl::nullopt,
                            absl::optional<uint32_t> overprovisioning_factor = absl::nullopt);
 
+  // Updates a priority whose hosts, their order and their localities are unchanged, e.g. when only
+  // the health, weight or metadata of some hosts changed. The hosts, per locality hosts and
+  // locality weights of the current host set are reused, and only the healthy, degraded or
+  // excluded partitions whose membership changed are rebuilt.
+  void updateClusterPrioritySetInPlace(const uint32_t priority);
+
   // Returns the saved priority state.
   PriorityState& priorityState() { return priority_state_; }
 
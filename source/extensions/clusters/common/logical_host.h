@@ -101,6 +101,7 @@ public:
     return logical_host_->outlierDetector();
   }
   HostStats& stats() const override { return logical_host_->stats(); }
+  HostStats* statsIfAllocated() const override { return logical_host_->statsIfAllocated(); }
   LoadMetricStats& loadMetricStats() const override { return logical_host_->loadMetricStats(); }
   const std::string& hostnameForHealthChecks() const override {
     return logical_host_->hostnameForHealthChecks();
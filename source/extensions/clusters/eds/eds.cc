@@ -379,8 +379,10 @@ void EdsClusterImpl::reloadHealthyHostsHelper(const HostSharedPtr& host) {
       host_to_exclude->healthFlagGet(Host::HealthFlag::PENDING_DYNAMIC_REMOVAL)) {
     // Empty for clarity.
   } else {
-    // Do not exclude and remove the host during the update.
-    host_to_exclude = nullptr;
+    // Nothing to remove, so only the partitions affected by the host's health change need to be
+    // updated.
+    ClusterImplBase::reloadHealthyHostsHelper(host);
+    return;
   }
 
   const auto& host_sets = prioritySet().hostSetsPerPriority();
@@ -433,9 +435,9 @@ bool EdsClusterImpl::updateHostsPerLocality(
   // about this. In the future we may need to do better here.
   const bool hosts_updated = updateDynamicHostList(new_hosts, *current_hosts_copy, hosts_added,
                                                    hosts_removed, all_hosts, all_new_hosts);
+  const bool locality_weights_updated = locality_weights_map != new_locality_weights_map;
   if (hosts_updated || host_set.weightedPriorityHealth() != weighted_priority_health ||
-      host_set.overprovisioningFactor() != overprovisioning_factor ||
-      locality_weights_map != new_locality_weights_map) {
+      host_set.overprovisioningFactor() != overprovisioning_factor || locality_weights_updated) {
     ASSERT(std::all_of(current_hosts_copy->begin(), current_hosts_copy->end(),
                        [&](const auto& host) { return host->priority() == priority; }));
     locality_weights_map = new_locality_weights_map;
@@ -443,9 +445,18 @@ bool EdsClusterImpl::updateHostsPerLocality(
               "EDS hosts or locality weights changed for cluster: {} current hosts {} priority {}",
               info_->name(), host_set.hosts().size(), host_set.priority());
 
-    priority_state_manager.updateClusterPrioritySet(
-        priority, std::move(current_hosts_copy), hosts_added, hosts_removed, absl::nullopt,
-        weighted_priority_health, overprovisioning_factor);
+    if (hosts_added.empty() && hosts_removed.empty() && !locality_weights_updated &&
+        host_set.weightedPriorityHealth() == weighted_priority_health &&
+        host_set.overprovisioningFactor() == overprovisioning_factor &&
+        *current_hosts_copy == host_set.hosts()) {
+      // The same hosts in the same order, with only their health, weights or metadata updated in
+      // place, so the host and per locality vectors of the host set can be kept.
+      priority_state_manager.updateClusterPrioritySetInPlace(priority);
+    } else {
+      priority_state_manager.updateClusterPrioritySet(
+          priority, std::move(current_hosts_copy), hosts_added, hosts_removed, absl::nullopt,
+          weighted_priority_health, overprovisioning_factor);
+    }
     return true;
   }
   return false;
@@ -149,6 +149,8 @@ absl::Status ThreadAwareLoadBalancerBase::refresh() {
   auto degraded_per_priority_load =
       std::make_shared<DegradedLoad>(per_priority_load_.degraded_priority_load_);
 
+  built_tables_.resize(priority_set_.hostSetsPerPriority().size());
+
   for (const auto& host_set : priority_set_.hostSetsPerPriority()) {
     const uint32_t priority = host_set->priority();
     (*per_priority_state_vector)[priority] = std::make_unique<PerPriorityState>();
@@ -165,8 +167,16 @@ absl::Status ThreadAwareLoadBalancerBase::refresh() {
                                            normalized_host_weights, min_normalized_weight,
                                            max_normalized_weight, locality_weighted_balancing_);
     RETURN_IF_NOT_OK(status);
-    per_priority_state->current_lb_ = createLoadBalancer(
-        std::move(normalized_host_weights), min_normalized_weight, max_normalized_weight);
+
+    // Host set updates usually only affect one priority, so avoid rebuilding the (potentially
+    // large) tables of the others.
+    BuiltTable& built_table = built_tables_[priority];
+    if (built_table.lb_ == nullptr || !built_table.matches(normalized_host_weights)) {
+      HashingLoadBalancerSharedPtr lb = createLoadBalancer(
+          normalized_host_weights, min_normalized_weight, max_normalized_weight);
+      built_table.update(std::move(normalized_host_weights), std::move(lb));
+    }
+    per_priority_state->current_lb_ = built_table.lb_;
   }
 
   {
@@ -178,6 +188,30 @@ absl::Status ThreadAwareLoadBalancerBase::refresh() {
   return absl::OkStatus();
 }
 
+bool ThreadAwareLoadBalancerBase::BuiltTable::matches(
+    const NormalizedHostWeightVector& normalized_host_weights) const {
+  if (normalized_host_weights != normalized_host_weights_) {
+    return false;
+  }
+  for (size_t i = 0; i < normalized_host_weights.size(); ++i) {
+    if (normalized_host_weights[i].first->metadata() != metadata_[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ThreadAwareLoadBalancerBase::BuiltTable::update(
+    NormalizedHostWeightVector&& normalized_host_weights, HashingLoadBalancerSharedPtr lb) {
+  metadata_.clear();
+  metadata_.reserve(normalized_host_weights.size());
+  for (const auto& host_weight : normalized_host_weights) {
+    metadata_.push_back(host_weight.first->metadata());
+  }
+  normalized_host_weights_ = std::move(normalized_host_weights);
+  lb_ = std::move(lb);
+}
+
 HostSelectionResponse
 ThreadAwareLoadBalancerBase::LoadBalancerImpl::chooseHost(LoadBalancerContext* context) {
   // Make sure we correctly return nullptr for any early chooseHost() calls.
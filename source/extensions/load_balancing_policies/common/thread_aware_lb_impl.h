@@ -173,6 +173,20 @@ private:
     std::shared_ptr<DegradedLoad> degraded_per_priority_load_ ABSL_GUARDED_BY(mutex_);
   };
 
+  // The inputs and result of the most recent table build of a priority. Tables are immutable once
+  // built and shared by all workers, so refresh() reuses the table of a priority whose inputs did
+  // not change rather than rebuilding it. Only accessed on the main thread.
+  struct BuiltTable {
+    bool matches(const NormalizedHostWeightVector& normalized_host_weights) const;
+    void update(NormalizedHostWeightVector&& normalized_host_weights,
+                HashingLoadBalancerSharedPtr lb);
+
+    NormalizedHostWeightVector normalized_host_weights_;
+    // The hash key of a host may come from its metadata, which can be replaced in place.
+    std::vector<MetadataConstSharedPtr> metadata_;
+    HashingLoadBalancerSharedPtr lb_;
+  };
+
   virtual HashingLoadBalancerSharedPtr
   createLoadBalancer(const NormalizedHostWeightVector& normalized_host_weights,
                      double min_normalized_weight, double max_normalized_weight) PURE;
@@ -181,6 +195,7 @@ private:
   std::shared_ptr<LoadBalancerFactoryImpl> factory_;
   const bool locality_weighted_balancing_{};
   Common::CallbackHandlePtr priority_update_cb_;
+  std::vector<BuiltTable> built_tables_;
 };
 
 class TypedHashLbConfigBase : public LoadBalancerConfig {
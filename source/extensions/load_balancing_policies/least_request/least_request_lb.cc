@@ -3,6 +3,17 @@
 namespace Envoy {
 namespace Upstream {
 
+namespace {
+
+// Returns the number of active requests of a host. Hosts which have never been used have no stats
+// allocated, so read them without allocating: this is called for every host in a full scan.
+uint64_t activeRequests(const Host& host) {
+  const HostStats* stats = host.statsIfAllocated();
+  return stats != nullptr ? stats->rq_active_.value() : 0;
+}
+
+} // namespace
+
 double LeastRequestLoadBalancer::hostWeight(const Host& host) const {
   // This method is called to calculate the dynamic weight as following when all load balancing
   // weights are not equal:
@@ -27,10 +38,10 @@ double LeastRequestLoadBalancer::hostWeight(const Host& host) const {
   // If the value of active requests is the max value, adding +1 will overflow
   // it and cause a divide by zero. This won't happen in normal cases but stops
   // failing fuzz tests
-  const uint64_t active_request_value =
-      host.stats().rq_active_.value() != std::numeric_limits<uint64_t>::max()
-          ? host.stats().rq_active_.value() + 1
-          : host.stats().rq_active_.value();
+  const uint64_t active_requests = activeRequests(host);
+  const uint64_t active_request_value = active_requests != std::numeric_limits<uint64_t>::max()
+                                            ? active_requests + 1
+                                            : active_requests;
 
   if (active_request_bias_ == 1.0) {
     host_weight = static_cast<double>(host.weight()) / active_request_value;
@@ -73,71 +84,64 @@ HostConstSharedPtr LeastRequestLoadBalancer::unweightedHostPick(const HostVector
 }
 
 HostSharedPtr LeastRequestLoadBalancer::unweightedHostPickFullScan(const HostVector& hosts_to_use) {
-  HostSharedPtr candidate_host = nullptr;
-
-  size_t num_hosts_known_tied_for_least = 0;
-
   const size_t num_hosts = hosts_to_use.size();
+  if (num_hosts == 0) {
+    return nullptr;
+  }
 
-  for (size_t i = 0; i < num_hosts; ++i) {
-    const HostSharedPtr& sampled_host = hosts_to_use[i];
+  // Track the candidate by index, and its active requests as read when it was chosen, so the scan
+  // neither copies host pointers nor re-reads the candidate's stats for every comparison.
+  size_t candidate_index = 0;
+  uint64_t candidate_active_rq = activeRequests(*hosts_to_use[0]);
+  size_t num_hosts_known_tied_for_least = 1;
 
-    if (candidate_host == nullptr) {
-      // Make a first choice to start the comparisons.
-      num_hosts_known_tied_for_least = 1;
-      candidate_host = sampled_host;
-      continue;
-    }
-
-    const auto candidate_active_rq = candidate_host->stats().rq_active_.value();
-    const auto sampled_active_rq = sampled_host->stats().rq_active_.value();
+  for (size_t i = 1; i < num_hosts; ++i) {
+    const uint64_t sampled_active_rq = activeRequests(*hosts_to_use[i]);
 
     if (sampled_active_rq < candidate_active_rq) {
       // Reset the count of known tied hosts.
       num_hosts_known_tied_for_least = 1;
-      candidate_host = sampled_host;
+      candidate_index = i;
+      candidate_active_rq = sampled_active_rq;
     } else if (sampled_active_rq == candidate_active_rq) {
       ++num_hosts_known_tied_for_least;
 
       // Use reservoir sampling to select 1 unique sample from the total number of hosts N
       // that will tie for least requests after processing the full hosts array.
       //
-      // Upon each new tie encountered, replace candidate_host with sampled_host
+      // Upon each new tie encountered, replace the candidate with the sampled host
       // with probability (1 / num_hosts_known_tied_for_least percent).
       // The end result is that each tied host has an equal 1 / N chance of being the
-      // candidate_host returned by this function.
+      // candidate returned by this function.
       const size_t random_tied_host_index = random_.random() % num_hosts_known_tied_for_least;
       if (random_tied_host_index == 0) {
-        candidate_host = sampled_host;
+        candidate_index = i;
       }
     }
   }
 
-  return candidate_host;
+  return hosts_to_use[candidate_index];
 }
 
 HostSharedPtr LeastRequestLoadBalancer::unweightedHostPickNChoices(const HostVector& hosts_to_use) {
-  HostSharedPtr candidate_host = nullptr;
-
-  for (uint32_t choice_idx = 0; choice_idx < choice_count_; ++choice_idx) {
-    const int rand_idx = random_.random() % hosts_to_use.size();
-    const HostSharedPtr& sampled_host = hosts_to_use[rand_idx];
+  if (hosts_to_use.empty() || choice_count_ == 0) {
+    return nullptr;
+  }
 
-    if (candidate_host == nullptr) {
-      // Make a first choice to start the comparisons.
-      candidate_host = sampled_host;
-      continue;
-    }
+  size_t candidate_index = random_.random() % hosts_to_use.size();
+  uint64_t candidate_active_rq = activeRequests(*hosts_to_use[candidate_index]);
 
-    const auto candidate_active_rq = candidate_host->stats().rq_active_.value();
-    const auto sampled_active_rq = sampled_host->stats().rq_active_.value();
+  for (uint32_t choice_idx = 1; choice_idx < choice_count_; ++choice_idx) {
+    const size_t rand_idx = random_.random() % hosts_to_use.size();
+    const uint64_t sampled_active_rq = activeRequests(*hosts_to_use[rand_idx]);
 
     if (sampled_active_rq < candidate_active_rq) {
-      candidate_host = sampled_host;
+      candidate_index = rand_idx;
+      candidate_active_rq = sampled_active_rq;
     }
   }
 
-  return candidate_host;
+  return hosts_to_use[candidate_index];
 }
 
 } // namespace Upstream
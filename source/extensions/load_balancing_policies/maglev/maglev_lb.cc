@@ -167,14 +167,12 @@ void OriginalMaglevTable::constructImplementationInternals(
         continue;
       }
       entry.target_weight_ += max_normalized_weight;
-      uint64_t c = permutation(entry);
-      while (table_[c] != nullptr) {
-        entry.next_++;
-        c = permutation(entry);
+      while (table_[entry.permutation_] != nullptr) {
+        nextPermutation(entry);
       }
 
-      table_[c] = entry.host_;
-      entry.next_++;
+      table_[entry.permutation_] = entry.host_;
+      nextPermutation(entry);
       entry.count_++;
       table_index++;
     }
@@ -219,17 +217,16 @@ void CompactMaglevTable::constructImplementationInternals(
       entry.target_weight_ += max_normalized_weight;
       // As we're using the compact implementation, our table size is limited to
       // 32-bit, hence static_cast here should be safe.
-      uint32_t c = static_cast<uint32_t>(permutation(entry));
-      while (occupied[c]) {
-        entry.next_++;
-        c = static_cast<uint32_t>(permutation(entry));
+      while (occupied[entry.permutation_]) {
+        nextPermutation(entry);
       }
+      const uint32_t c = static_cast<uint32_t>(entry.permutation_);
 
       // Record the index of the given host.
       table_.set(c, i);
       occupied[c] = true;
 
-      entry.next_++;
+      nextPermutation(entry);
       entry.count_++;
       table_index++;
     }
@@ -292,10 +289,6 @@ HostSelectionResponse CompactMaglevTable::chooseHost(uint64_t hash, uint32_t att
   return {host_table_[index]};
 }
 
-uint64_t MaglevTable::permutation(const TableBuildEntry& entry) {
-  return (entry.offset_ + (entry.skip_ * entry.next_)) % table_size_;
-}
-
 MaglevLoadBalancer::MaglevLoadBalancer(const PrioritySet& priority_set, ClusterLbStats& stats,
                                        Stats::Scope& scope, Runtime::Loader& runtime,
                                        Random::RandomGenerator& random,
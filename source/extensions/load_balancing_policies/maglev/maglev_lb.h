@@ -75,18 +75,28 @@ public:
 protected:
   struct TableBuildEntry {
     TableBuildEntry(const HostConstSharedPtr& host, uint64_t offset, uint64_t skip, double weight)
-        : host_(host), offset_(offset), skip_(skip), weight_(weight) {}
+        : host_(host), skip_(skip), weight_(weight), permutation_(offset) {}
 
     HostConstSharedPtr host_;
-    const uint64_t offset_;
     const uint64_t skip_;
     const double weight_;
     double target_weight_{};
-    uint64_t next_{};
+    // The current position in the host's permutation of the table, i.e.
+    // (offset + skip * next) % table_size where next is the number of positions tried so far.
+    uint64_t permutation_;
     uint64_t count_{};
   };
 
-  uint64_t permutation(const TableBuildEntry& entry);
+  /**
+   * Advances the entry to the next position in its permutation. As both the position and the skip
+   * are smaller than the table size, this avoids a multiplication and a division per position.
+   */
+  void nextPermutation(TableBuildEntry& entry) const {
+    entry.permutation_ += entry.skip_;
+    if (entry.permutation_ >= table_size_) {
+      entry.permutation_ -= table_size_;
+    }
+  }
 
   /**
    * Template method for constructing the Maglev table.
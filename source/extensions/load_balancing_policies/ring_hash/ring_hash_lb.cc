@@ -10,6 +10,7 @@
 #include "source/common/common/assert.h"
 
 #include "absl/container/inlined_vector.h"
+#include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 
 namespace Envoy {
@@ -187,8 +188,9 @@ RingHashLoadBalancer::Ring::Ring(const NormalizedHostWeightVector& normalized_ho
     target_hashes += scale * entry.second;
     uint64_t i = 0;
     while (current_hashes < target_hashes) {
-      const std::string i_str = absl::StrCat("", i);
-      hash_key_buffer.insert(offset_start, i_str.begin(), i_str.end());
+      // AlphaNum formats into an internal buffer, avoiding an allocation per hash.
+      const absl::AlphaNum i_str(i);
+      hash_key_buffer.insert(offset_start, i_str.data(), i_str.data() + i_str.size());
 
       absl::string_view hash_key(static_cast<char*>(hash_key_buffer.data()),
                                  hash_key_buffer.size());
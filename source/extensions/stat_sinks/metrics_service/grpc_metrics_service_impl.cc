@@ -12,6 +12,7 @@
 #include "source/common/common/assert.h"
 #include "source/common/common/utility.h"
 #include "source/common/config/utility.h"
+#include "source/common/stats/histogram_impl.h"
 
 namespace Envoy {
 namespace Extensions {
@@ -78,6 +79,9 @@ MetricsPtr MetricsFlusher::flush(Stats::MetricSnapshot& snapshot) const {
       if (emit_histogram_) {
         flushHistogram(*metrics->Add(), histogram.get(), snapshot_time_ms);
       }
+      if (emit_native_histogram_) {
+        flushNativeHistogram(*metrics->Add(), histogram.get(), snapshot_time_ms);
+      }
     }
   }
 
@@ -123,6 +127,56 @@ void MetricsFlusher::flushHistogram(io::prometheus::client::MetricFamily& metric
   }
 }
 
+void MetricsFlusher::flushNativeHistogram(io::prometheus::client::MetricFamily& metrics_family,
+                                          const Stats::ParentHistogram& envoy_histogram,
+                                          int64_t snapshot_time_ms) const {
+  // Prometheus supports schemas -4 to 8; 160 buckets is the default Prometheus bucket limit.
+  constexpr int32_t MinSchema = -4;
+  constexpr int32_t MaxSchema = 8;
+  constexpr uint32_t MaxBuckets = 160;
+
+  const Stats::HistogramStatistics& hist_stats = envoy_histogram.intervalStatistics();
+  const Stats::ExponentialHistogram exponential = Stats::ExponentialHistogram::fromBuckets(
+      envoy_histogram.detailedIntervalBuckets(), envoy_histogram.unit(), MinSchema, MaxSchema,
+      MaxBuckets);
+  auto* histogram_metric =
+      populateMetricsFamily(metrics_family, io::prometheus::client::MetricType::HISTOGRAM,
+                            snapshot_time_ms, envoy_histogram);
+  auto* histogram = histogram_metric->mutable_histogram();
+  histogram->set_sample_count(hist_stats.sampleCount());
+  histogram->set_sample_sum(hist_stats.sampleSum());
+  histogram->set_schema(exponential.scale_);
+  histogram->set_zero_threshold(0);
+  histogram->set_zero_count(exponential.zero_count_);
+
+  // Native histograms are sparse: each span covers a run of populated buckets, and is placed
+  // relative to the end of the previous span. Counts are delta-encoded across all spans.
+  io::prometheus::client::BucketSpan* span = nullptr;
+  int32_t next_index = exponential.offset_;
+  int64_t previous_count = 0;
+  for (size_t i = 0; i < exponential.bucket_counts_.size(); ++i) {
+    const uint64_t count = exponential.bucket_counts_[i];
+    if (count == 0) {
+      span = nullptr;
+      continue;
+    }
+    // Prometheus bucket i covers (base^(i-1), base^i], one above the OpenTelemetry index.
+    const int32_t index = exponential.offset_ + i + 1;
+    if (span == nullptr) {
+      span = histogram->add_positive_span();
+      span->set_offset(histogram->positive_span_size() == 1 ? index : index - next_index);
+    }
+    span->set_length(span->length() + 1);
+    next_index = index + 1;
+    histogram->add_positive_delta(static_cast<int64_t>(count) - previous_count);
+    previous_count = count;
+  }
+  if (histogram->positive_span_size() == 0) {
+    // An empty span distinguishes an empty native histogram from a classic one.
+    histogram->add_positive_span();
+  }
+}
+
 void MetricsFlusher::flushSummary(io::prometheus::client::MetricFamily& metrics_family,
                                   const Stats::ParentHistogram& envoy_histogram,
                                   int64_t snapshot_time_ms) const {
@@ -98,6 +98,7 @@ public:
                       histogram_emit_mode == HistogramEmitMode::SUMMARY),
         emit_histogram_(histogram_emit_mode == HistogramEmitMode::SUMMARY_AND_HISTOGRAM ||
                         histogram_emit_mode == HistogramEmitMode::HISTOGRAM),
+        emit_native_histogram_(histogram_emit_mode == HistogramEmitMode::NATIVE_HISTOGRAM),
         predicate_(predicate) {}
 
   MetricsPtr flush(Stats::MetricSnapshot& snapshot) const;
@@ -111,6 +112,9 @@ private:
   void flushHistogram(io::prometheus::client::MetricFamily& metrics_family,
                       const Stats::ParentHistogram& envoy_histogram,
                       int64_t snapshot_time_ms) const;
+  void flushNativeHistogram(io::prometheus::client::MetricFamily& metrics_family,
+                            const Stats::ParentHistogram& envoy_histogram,
+                            int64_t snapshot_time_ms) const;
   void flushSummary(io::prometheus::client::MetricFamily& metrics_family,
                     const Stats::ParentHistogram& envoy_histogram, int64_t snapshot_time_ms) const;
 
@@ -123,6 +127,7 @@ private:
   const bool emit_labels_;
   const bool emit_summary_;
   const bool emit_histogram_;
+  const bool emit_native_histogram_;
   const std::function<bool(const Stats::Metric&)> predicate_;
 };
 
@@ -1,5 +1,6 @@
 #include "source/extensions/stat_sinks/open_telemetry/open_telemetry_impl.h"
 
+#include "source/common/stats/histogram_impl.h"
 #include "source/common/tracing/null_span_impl.h"
 
 namespace Envoy {
@@ -22,6 +23,7 @@ OtlpOptions::OtlpOptions(const SinkConfig& sink_config,
                          const Tracers::OpenTelemetry::Resource& resource)
     : report_counters_as_deltas_(sink_config.report_counters_as_deltas()),
       report_histograms_as_deltas_(sink_config.report_histograms_as_deltas()),
+      report_histograms_as_exponential_(sink_config.report_histograms_as_exponential()),
       emit_tags_as_attributes_(
           PROTOBUF_GET_WRAPPED_OR_DEFAULT(sink_config, emit_tags_as_attributes, true)),
       use_tag_extracted_name_(
@@ -89,7 +91,11 @@ MetricsExportRequestPtr OtlpMetricsFlusherImpl::flush(Stats::MetricSnapshot& sna
 
   for (const auto& histogram : snapshot.histograms()) {
     if (predicate_(histogram)) {
-      flushHistogram(*scope_metrics->add_metrics(), histogram, snapshot_time_ns);
+      if (config_->reportHistogramsAsExponential()) {
+        flushExponentialHistogram(*scope_metrics->add_metrics(), histogram, snapshot_time_ns);
+      } else {
+        flushHistogram(*scope_metrics->add_metrics(), histogram, snapshot_time_ns);
+      }
     }
   }
 
@@ -130,7 +136,7 @@ void OtlpMetricsFlusherImpl::flushHistogram(opentelemetry::proto::metrics::v1::M
                                             int64_t snapshot_time_ns) const {
   auto* histogram = metric.mutable_histogram();
   auto* data_point = histogram->add_data_points();
-  setMetricCommon(metric, *data_point, snapshot_time_ns, parent_histogram);
+  setHistogramMetricCommon(metric, *data_point, snapshot_time_ns, parent_histogram);
 
   histogram->set_aggregation_temporality(
       config_->reportHistogramsAsDeltas()
@@ -157,6 +163,41 @@ void OtlpMetricsFlusherImpl::flushHistogram(opentelemetry::proto::metrics::v1::M
   data_point->add_bucket_counts(histogram_stats.outOfBoundCount());
 }
 
+void OtlpMetricsFlusherImpl::flushExponentialHistogram(
+    opentelemetry::proto::metrics::v1::Metric& metric,
+    const Stats::ParentHistogram& parent_histogram, int64_t snapshot_time_ns) const {
+  // The scale range defined by the OTLP data model, and the default maximum size used by the
+  // OpenTelemetry SDKs for the base-2 exponential histogram aggregation.
+  constexpr int32_t MinScale = -10;
+  constexpr int32_t MaxScale = 20;
+  constexpr uint32_t MaxBuckets = 160;
+
+  auto* histogram = metric.mutable_exponential_histogram();
+  auto* data_point = histogram->add_data_points();
+  setHistogramMetricCommon(metric, *data_point, snapshot_time_ns, parent_histogram);
+
+  const bool deltas = config_->reportHistogramsAsDeltas();
+  histogram->set_aggregation_temporality(
+      deltas ? AggregationTemporality::AGGREGATION_TEMPORALITY_DELTA
+             : AggregationTemporality::AGGREGATION_TEMPORALITY_CUMULATIVE);
+
+  const Stats::HistogramStatistics& histogram_stats =
+      deltas ? parent_histogram.intervalStatistics() : parent_histogram.cumulativeStatistics();
+  const Stats::ExponentialHistogram exponential = Stats::ExponentialHistogram::fromBuckets(
+      deltas ? parent_histogram.detailedIntervalBuckets()
+             : parent_histogram.detailedTotalBuckets(),
+      parent_histogram.unit(), MinScale, MaxScale, MaxBuckets);
+
+  data_point->set_count(histogram_stats.sampleCount());
+  data_point->set_sum(histogram_stats.sampleSum());
+  data_point->set_scale(exponential.scale_);
+  data_point->set_zero_count(exponential.zero_count_);
+  auto* positive = data_point->mutable_positive();
+  positive->set_offset(exponential.offset_);
+  positive->mutable_bucket_counts()->Add(exponential.bucket_counts_.begin(),
+                                         exponential.bucket_counts_.end());
+}
+
 template <class StatType>
 void OtlpMetricsFlusherImpl::setMetricCommon(
     opentelemetry::proto::metrics::v1::Metric& metric,
@@ -177,10 +218,10 @@ void OtlpMetricsFlusherImpl::setMetricCommon(
   }
 }
 
-void OtlpMetricsFlusherImpl::setMetricCommon(
-    opentelemetry::proto::metrics::v1::Metric& metric,
-    opentelemetry::proto::metrics::v1::HistogramDataPoint& data_point, int64_t snapshot_time_ns,
-    const Stats::Metric& stat) const {
+template <class HistogramDataPoint>
+void OtlpMetricsFlusherImpl::setHistogramMetricCommon(
+    opentelemetry::proto::metrics::v1::Metric& metric, HistogramDataPoint& data_point,
+    int64_t snapshot_time_ns, const Stats::Metric& stat) const {
   data_point.set_time_unix_nano(snapshot_time_ns);
   // TODO(ohadvano): support ``start_time_unix_nano optional`` field
   metric.set_name(absl::StrCat(config_->statPrefix(), config_->useTagExtractedName()
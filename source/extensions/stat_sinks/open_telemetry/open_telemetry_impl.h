@@ -40,6 +40,7 @@ public:
 
   bool reportCountersAsDeltas() { return report_counters_as_deltas_; }
   bool reportHistogramsAsDeltas() { return report_histograms_as_deltas_; }
+  bool reportHistogramsAsExponential() { return report_histograms_as_exponential_; }
   bool emitTagsAsAttributes() { return emit_tags_as_attributes_; }
   bool useTagExtractedName() { return use_tag_extracted_name_; }
   const std::string& statPrefix() { return stat_prefix_; }
@@ -51,6 +52,7 @@ public:
 private:
   const bool report_counters_as_deltas_;
   const bool report_histograms_as_deltas_;
+  const bool report_histograms_as_exponential_;
   const bool emit_tags_as_attributes_;
   const bool use_tag_extracted_name_;
   const std::string stat_prefix_;
@@ -97,14 +99,19 @@ private:
                       const Stats::ParentHistogram& parent_histogram,
                       int64_t snapshot_time_ns) const;
 
+  void flushExponentialHistogram(opentelemetry::proto::metrics::v1::Metric& metric,
+                                 const Stats::ParentHistogram& parent_histogram,
+                                 int64_t snapshot_time_ns) const;
+
   template <class StatType>
   void setMetricCommon(opentelemetry::proto::metrics::v1::Metric& metric,
                        opentelemetry::proto::metrics::v1::NumberDataPoint& data_point,
                        int64_t snapshot_time_ns, const StatType& stat) const;
 
-  void setMetricCommon(opentelemetry::proto::metrics::v1::Metric& metric,
-                       opentelemetry::proto::metrics::v1::HistogramDataPoint& data_point,
-                       int64_t snapshot_time_ns, const Stats::Metric& stat) const;
+  template <class HistogramDataPoint>
+  void setHistogramMetricCommon(opentelemetry::proto::metrics::v1::Metric& metric,
+                                HistogramDataPoint& data_point, int64_t snapshot_time_ns,
+                                const Stats::Metric& stat) const;
 
   const OtlpOptionsSharedPtr config_;
   const std::function<bool(const Stats::Metric&)> predicate_;
@@ -130,6 +130,43 @@ std::string generateHistogramOutput(const Stats::ParentHistogram& histogram,
   return output;
 };
 
+template <class StatType>
+using GenerateOutputFn = std::function<std::string(const StatType& metric,
+                                                   const std::string& prefixed_tag_extracted_name)>;
+
+/**
+ * Outputs the metrics sharing a tag-extracted name as a single group, sorted by name.
+ *
+ * @param response The buffer to put the output into.
+ * @param tag_extracted_name The tag-extracted name of the metrics.
+ * @param metrics The metrics of the group, which are sorted in place.
+ * @param generate_output A function which returns the output text for this metric.
+ * @param type The name of the prometheus metric type for used in TYPE annotations.
+ * @return whether the group was output, which requires a valid metric name.
+ */
+template <class StatType>
+bool outputFamily(Buffer::Instance& response, const std::string& tag_extracted_name,
+                  std::vector<const StatType*>& metrics,
+                  const GenerateOutputFn<StatType>& generate_output, absl::string_view type,
+                  const Stats::CustomStatNamespaces& custom_namespaces) {
+  const absl::optional<std::string> prefixed_tag_extracted_name =
+      PrometheusStatsFormatter::metricName(tag_extracted_name, custom_namespaces);
+  if (!prefixed_tag_extracted_name.has_value()) {
+    return false;
+  }
+  response.add(fmt::format("# TYPE {0} {1}\n", prefixed_tag_extracted_name.value(), type));
+
+  // Sort before producing the final output to satisfy the "preferred" ordering from the
+  // prometheus spec: metrics will be sorted by their tags' textual representation, which will
+  // be consistent across calls.
+  std::sort(metrics.begin(), metrics.end(), MetricLessThan());
+
+  for (const StatType* metric : metrics) {
+    response.add(generate_output(*metric, prefixed_tag_extracted_name.value()));
+  }
+  return true;
+}
+
 /**
  * Processes a stat type (counter, gauge, histogram) by generating all output lines, sorting
  * them by tag-extracted metric name, and then outputting them in the correct sorted order into
@@ -144,12 +181,10 @@ std::string generateHistogramOutput(const Stats::ParentHistogram& histogram,
  * @param type The name of the prometheus metric type for used in TYPE annotations.
  */
 template <class StatType>
-uint64_t outputStatType(
-    Buffer::Instance& response, const StatsParams& params,
-    const std::vector<Stats::RefcountPtr<StatType>>& metrics,
-    const std::function<std::string(
-        const StatType& metric, const std::string& prefixed_tag_extracted_name)>& generate_output,
-    absl::string_view type, const Stats::CustomStatNamespaces& custom_namespaces) {
+uint64_t outputStatType(Buffer::Instance& response, const StatsParams& params,
+                        const std::vector<Stats::RefcountPtr<StatType>>& metrics,
+                        const GenerateOutputFn<StatType>& generate_output, absl::string_view type,
+                        const Stats::CustomStatNamespaces& custom_namespaces) {
 
   /*
    * From
@@ -192,24 +227,11 @@ uint64_t outputStatType(
     groups[metric->tagExtractedStatName()].push_back(metric.get());
   }
 
-  auto result = groups.size();
+  uint64_t result = 0;
   for (auto& group : groups) {
-    const absl::optional<std::string> prefixed_tag_extracted_name =
-        PrometheusStatsFormatter::metricName(global_symbol_table.toString(group.first),
-                                             custom_namespaces);
-    if (!prefixed_tag_extracted_name.has_value()) {
-      --result;
-      continue;
-    }
-    response.add(fmt::format("# TYPE {0} {1}\n", prefixed_tag_extracted_name.value(), type));
-
-    // Sort before producing the final output to satisfy the "preferred" ordering from the
-    // prometheus spec: metrics will be sorted by their tags' textual representation, which will
-    // be consistent across calls.
-    std::sort(group.second.begin(), group.second.end(), MetricLessThan());
-
-    for (const auto& metric : group.second) {
-      response.add(generate_output(*metric, prefixed_tag_extracted_name.value()));
+    if (outputFamily<StatType>(response, global_symbol_table.toString(group.first), group.second,
+                               generate_output, type, custom_namespaces)) {
+      ++result;
     }
   }
   return result;
@@ -305,6 +327,46 @@ std::string generateSummaryOutput(const Stats::ParentHistogram& histogram,
   return output;
 };
 
+/*
+ * Outputs the per-host metrics, which are generated from the clusters rather than held in the
+ * stats store.
+ */
+uint64_t outputHostMetrics(Buffer::Instance& response, const StatsParams& params,
+                           const Upstream::ClusterManager& cluster_manager,
+                           const Stats::CustomStatNamespaces& custom_namespaces) {
+  // Note: This assumes that there is no overlap in stat name between per-endpoint stats and all
+  // other stats. If this is not true, then the counters/gauges for per-endpoint need to be combined
+  // with the above counter/gauge calls so that stats can be properly grouped.
+  std::vector<Stats::PrimitiveCounterSnapshot> host_counters;
+  std::vector<Stats::PrimitiveGaugeSnapshot> host_gauges;
+  Upstream::HostUtility::forEachHostMetric(
+      cluster_manager,
+      [&](Stats::PrimitiveCounterSnapshot&& metric) {
+        host_counters.emplace_back(std::move(metric));
+      },
+      [&](Stats::PrimitiveGaugeSnapshot&& metric) { host_gauges.emplace_back(std::move(metric)); });
+
+  return outputPrimitiveStatType(response, params, host_counters, "counter", custom_namespaces) +
+         outputPrimitiveStatType(response, params, host_gauges, "gauge", custom_namespaces);
+}
+
+/*
+ * Outputs a group of metrics held by a PrometheusStatsRequest, which all have the given type.
+ */
+template <class StatType>
+void renderMetrics(Buffer::Instance& response, const std::string& tag_extracted_name,
+                   const std::vector<Stats::RefcountPtr<Stats::Metric>>& metrics,
+                   const GenerateOutputFn<StatType>& generate_output, absl::string_view type,
+                   const Stats::CustomStatNamespaces& custom_namespaces) {
+  std::vector<const StatType*> typed_metrics;
+  typed_metrics.reserve(metrics.size());
+  for (const Stats::RefcountPtr<Stats::Metric>& metric : metrics) {
+    typed_metrics.push_back(static_cast<const StatType*>(metric.get()));
+  }
+  outputFamily<StatType>(response, tag_extracted_name, typed_metrics, generate_output, type,
+                         custom_namespaces);
+}
+
 } // namespace
 
 std::string PrometheusStatsFormatter::formattedTags(const std::vector<Stats::Tag>& tags) {
@@ -397,25 +459,113 @@ uint64_t PrometheusStatsFormatter::statsAsPrometheus(
     break;
   }
 
-  // Note: This assumes that there is no overlap in stat name between per-endpoint stats and all
-  // other stats. If this is not true, then the counters/gauges for per-endpoint need to be combined
-  // with the above counter/gauge calls so that stats can be properly grouped.
-  std::vector<Stats::PrimitiveCounterSnapshot> host_counters;
-  std::vector<Stats::PrimitiveGaugeSnapshot> host_gauges;
-  Upstream::HostUtility::forEachHostMetric(
-      cluster_manager,
-      [&](Stats::PrimitiveCounterSnapshot&& metric) {
-        host_counters.emplace_back(std::move(metric));
-      },
-      [&](Stats::PrimitiveGaugeSnapshot&& metric) { host_gauges.emplace_back(std::move(metric)); });
+  metric_name_count += outputHostMetrics(response, params, cluster_manager, custom_namespaces);
 
-  metric_name_count +=
-      outputPrimitiveStatType(response, params, host_counters, "counter", custom_namespaces);
+  return metric_name_count;
+}
 
-  metric_name_count +=
-      outputPrimitiveStatType(response, params, host_gauges, "gauge", custom_namespaces);
+PrometheusStatsRequest::PrometheusStatsRequest(Stats::Store& stats, const StatsParams& params,
+                                               const Upstream::ClusterManager& cluster_manager,
+                                               const Stats::CustomStatNamespaces& custom_namespaces)
+    : stats_(stats), params_(params), cluster_manager_(cluster_manager),
+      custom_namespaces_(custom_namespaces), families_(stats.symbolTable()) {}
 
-  return metric_name_count;
+Http::Code PrometheusStatsRequest::start(Http::ResponseHeaderMap&) {
+  populateFamilies();
+  return Http::Code::OK;
+}
+
+bool PrometheusStatsRequest::nextChunk(Buffer::Instance& response) {
+  // nextChunk's contract is to add up to chunk_size_ additional bytes. The
+  // caller is not required to drain the bytes after each call to nextChunk.
+  const uint64_t starting_response_length = response.length();
+  while (response.length() - starting_response_length < chunk_size_) {
+    while (families_.empty()) {
+      switch (phase_) {
+      case Phase::Counters:
+        phase_ = Phase::Gauges;
+        break;
+      case Phase::Gauges:
+        phase_ = Phase::TextReadouts;
+        break;
+      case Phase::TextReadouts:
+        phase_ = Phase::Histograms;
+        break;
+      case Phase::Histograms:
+        renderHostMetrics(response);
+        return false;
+      }
+      populateFamilies();
+    }
+
+    // Release the references to the metrics as soon as they are rendered.
+    auto iter = families_.begin();
+    renderFamily(iter->first, iter->second, response);
+    families_.erase(iter);
+  }
+  return true;
+}
+
+void PrometheusStatsRequest::populateFamilies() {
+  ASSERT(families_.empty());
+  auto add_metric = [this](Stats::Metric& metric) {
+    if (params_.shouldShowMetric(metric)) {
+      families_[metric.tagExtractedStatName()].emplace_back(&metric);
+    }
+  };
+  switch (phase_) {
+  case Phase::Counters:
+    stats_.forEachCounter(nullptr, add_metric);
+    break;
+  case Phase::Gauges:
+    stats_.forEachGauge(nullptr, add_metric);
+    break;
+  case Phase::TextReadouts:
+    if (params_.prometheus_text_readouts_) {
+      stats_.forEachTextReadout(nullptr, add_metric);
+    }
+    break;
+  case Phase::Histograms:
+    stats_.forEachHistogram(nullptr, add_metric);
+    break;
+  }
+}
+
+void PrometheusStatsRequest::renderFamily(Stats::StatName tag_extracted_name,
+                                          const MetricVec& metrics, Buffer::Instance& response) {
+  const std::string name = stats_.symbolTable().toString(tag_extracted_name);
+  switch (phase_) {
+  case Phase::Counters:
+    renderMetrics<Stats::Counter>(response, name, metrics,
+                                  generateStatNumericOutput<Stats::Counter>, "counter",
+                                  custom_namespaces_);
+    break;
+  case Phase::Gauges:
+    renderMetrics<Stats::Gauge>(response, name, metrics, generateStatNumericOutput<Stats::Gauge>,
+                                "gauge", custom_namespaces_);
+    break;
+  case Phase::TextReadouts:
+    // TextReadout stats are returned in gauge format, so "gauge" type is set intentionally.
+    renderMetrics<Stats::TextReadout>(response, name, metrics, generateTextReadoutOutput, "gauge",
+                                      custom_namespaces_);
+    break;
+  case Phase::Histograms:
+    // The bucket mode is validated before the request is created.
+    if (params_.histogram_buckets_mode_ == Utility::HistogramBucketsMode::Summary) {
+      renderMetrics<Stats::ParentHistogram>(response, name, metrics, generateSummaryOutput,
+                                            "summary", custom_namespaces_);
+    } else {
+      renderMetrics<Stats::ParentHistogram>(response, name, metrics, generateHistogramOutput,
+                                            "histogram", custom_namespaces_);
+    }
+    break;
+  }
+}
+
+void PrometheusStatsRequest::renderHostMetrics(Buffer::Instance& response) {
+  // As in StatsRequest, the per-host metrics are rendered in one batch, as there is no reference
+  // to hold on them while pausing the iteration.
+  outputHostMetrics(response, params_, cluster_manager_, custom_namespaces_);
 }
 
 } // namespace Server
@@ -1,13 +1,17 @@
 #pragma once
 
+#include <map>
 #include <regex>
 #include <string>
 
 #include "envoy/buffer/buffer.h"
+#include "envoy/server/admin.h"
 #include "envoy/stats/custom_stat_namespaces.h"
 #include "envoy/stats/histogram.h"
 #include "envoy/stats/stats.h"
+#include "envoy/stats/store.h"
 
+#include "source/common/stats/symbol_table.h"
 #include "source/server/admin/stats_params.h"
 
 namespace Envoy {
@@ -53,5 +57,52 @@ public:
              const Stats::CustomStatNamespaces& custom_namespace_factory);
 };
 
+// Streams stats in the Prometheus exposition format, implementing the
+// Admin::Request interface.
+//
+// The exposition format requires all the metrics with the same tag-extracted
+// name to be emitted together, so unlike StatsRequest we can't visit the scopes
+// in name order. Instead, each stat type is indexed by tag-extracted name when
+// its turn comes, holding a reference to each metric rather than any rendered
+// text, and the families are rendered and released in order, a chunk at a time.
+// The memory held is thus proportional to the number of stats of one type,
+// rather than to the size of the exposition.
+class PrometheusStatsRequest : public Admin::Request {
+public:
+  static constexpr uint64_t DefaultChunkSize = 2 * 1000 * 1000;
+
+  PrometheusStatsRequest(Stats::Store& stats, const StatsParams& params,
+                         const Upstream::ClusterManager& cluster_manager,
+                         const Stats::CustomStatNamespaces& custom_namespaces);
+
+  // Admin::Request
+  Http::Code start(Http::ResponseHeaderMap& response_headers) override;
+  bool nextChunk(Buffer::Instance& response) override;
+
+  // Sets the chunk size.
+  void setChunkSize(uint64_t chunk_size) { chunk_size_ = chunk_size; }
+
+private:
+  // Stat types are emitted in this order, followed by the per-host metrics.
+  enum class Phase { Counters, Gauges, TextReadouts, Histograms };
+
+  using MetricVec = std::vector<Stats::RefcountPtr<Stats::Metric>>;
+  using FamilyMap = std::map<Stats::StatName, MetricVec, Stats::StatNameLessThan>;
+
+  // Indexes the stats of the current phase by tag-extracted name.
+  void populateFamilies();
+  void renderFamily(Stats::StatName tag_extracted_name, const MetricVec& metrics,
+                    Buffer::Instance& response);
+  void renderHostMetrics(Buffer::Instance& response);
+
+  Stats::Store& stats_;
+  const StatsParams params_;
+  const Upstream::ClusterManager& cluster_manager_;
+  const Stats::CustomStatNamespaces& custom_namespaces_;
+  Phase phase_{Phase::Counters};
+  FamilyMap families_;
+  uint64_t chunk_size_{DefaultChunkSize};
+};
+
 } // namespace Server
 } // namespace Envoy
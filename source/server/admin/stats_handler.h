@@ -33,43 +33,6 @@ public:
                                               Buffer::Instance& response, AdminStream&);
   Http::Code handlerStatsRecentLookupsEnable(Http::ResponseHeaderMap& response_headers,
                                              Buffer::Instance& response, AdminStream&);
-  Http::Code handlerPrometheusStats(Http::ResponseHeaderMap& response_headers,
-                                    Buffer::Instance& response, AdminStream&);
-
-  /**
-   * Parses and executes a prometheus stats request.
-   *
-   * @param path_and_query the URL path and query
-   * @param response buffer into which to write response
-   * @return http response code
-   */
-  Http::Code prometheusStats(absl::string_view path_and_query, Buffer::Instance& response);
-
-  /**
-   * Checks the server_ to see if a flush is needed, and then renders the
-   * prometheus stats request.
-   *
-   * @params params the already-parsed parameters.
-   * @param response buffer into which to write response
-   */
-  Http::Code prometheusFlushAndRender(const StatsParams& params, Buffer::Instance& response);
-
-  /**
-   * Renders the stats as prometheus. This is broken out as a separately
-   * callable API to facilitate the benchmark
-   * (test/server/admin/stats_handler_speed_test.cc) which does not have a
-   * server object.
-   *
-   * @params stats the stats store to read
-   * @param custom_namespaces namespace mappings used for prometheus
-   * @params params the already-parsed parameters.
-   * @param response buffer into which to write response
-   */
-  static void prometheusRender(Stats::Store& stats,
-                               const Stats::CustomStatNamespaces& custom_namespaces,
-                               const Upstream::ClusterManager& cluster_manager,
-                               const StatsParams& params, Buffer::Instance& response);
-
   Http::Code handlerContention(Http::ResponseHeaderMap& response_headers,
                                Buffer::Instance& response, AdminStream&);
 
@@ -87,15 +50,36 @@ public:
    */
   Admin::UrlHandler statsHandler(bool active_mode);
 
+  /**
+   * @return a URL handler streaming the stats in prometheus format.
+   */
+  Admin::UrlHandler prometheusStatsHandler();
+
   static Admin::RequestPtr makeRequest(Stats::Store& stats, const StatsParams& params,
                                        const Upstream::ClusterManager& cm,
                                        StatsRequest::UrlHandlerFn url_handler_fn = nullptr);
   Admin::RequestPtr makeRequest(AdminStream&);
 
+  /**
+   * Creates a request streaming the stats as prometheus. This is broken out as
+   * a separately callable API to facilitate the benchmark
+   * (test/server/admin/stats_handler_speed_test.cc) which does not have a
+   * server object.
+   *
+   * @param stats the stats store to read
+   * @param custom_namespaces namespace mappings used for prometheus
+   * @param cluster_manager the cluster manager providing the per-host metrics
+   * @param params the already-parsed and validated parameters.
+   * @return the request.
+   */
+  static Admin::RequestPtr
+  makePrometheusRequest(Stats::Store& stats, const Stats::CustomStatNamespaces& custom_namespaces,
+                        const Upstream::ClusterManager& cluster_manager, const StatsParams& params);
+
 private:
-  static Http::Code prometheusStats(absl::string_view path_and_query, Buffer::Instance& response,
-                                    Stats::Store& stats,
-                                    Stats::CustomStatNamespaces& custom_namespaces);
+  Admin::RequestPtr makePrometheusRequest(AdminStream& admin_stream);
+  // Validates the parameters and flushes the stats if configured, before creating the request.
+  Admin::RequestPtr makePrometheusRequest(const StatsParams& params);
 };
 
 } // namespace Server
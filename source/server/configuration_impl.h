@@ -56,6 +56,7 @@ public:
   const std::list<Stats::SinkPtr>& sinks() const override { return sinks_; }
   std::chrono::milliseconds flushInterval() const override { return flush_interval_; }
   bool flushOnAdmin() const override { return flush_on_admin_; }
+  bool flushChangedOnly() const override { return flush_changed_only_; }
   uint32_t evictOnFlush() const override { return evict_on_flush_; }
 
   void addSink(Stats::SinkPtr sink) { sinks_.emplace_back(std::move(sink)); }
@@ -67,6 +68,7 @@ private:
   std::list<Stats::SinkPtr> sinks_;
   std::chrono::milliseconds flush_interval_;
   bool flush_on_admin_{false};
+  const bool flush_changed_only_;
   const envoy::config::bootstrap::v3::Bootstrap::DeferredStatOptions deferred_stat_options_;
   uint32_t evict_on_flush_{0};
 };
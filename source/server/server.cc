@@ -26,6 +26,7 @@
 
 #include "source/common/api/api_impl.h"
 #include "source/common/api/os_sys_calls_impl.h"
+#include "source/common/buffer/watermark_buffer.h"
 #include "source/common/common/enum_to_int.h"
 #include "source/common/common/mutex_tracer_impl.h"
 #include "source/common/common/notification.h"
@@ -170,51 +171,73 @@ void InstanceBase::failHealthcheck(bool fail) {
 
 MetricSnapshotImpl::MetricSnapshotImpl(Stats::Store& store,
                                        Upstream::ClusterManager& cluster_manager,
-                                       TimeSource& time_source) {
+                                       TimeSource& time_source, bool changed_only) {
+  // When only changed metrics are requested, the containers are not reserved up front as they
+  // are expected to hold a small fraction of the stats.
   store.forEachSinkedCounter(
-      [this](std::size_t size) {
-        snapped_counters_.reserve(size);
-        counters_.reserve(size);
+      [this, changed_only](std::size_t size) {
+        if (!changed_only) {
+          snapped_counters_.reserve(size);
+          counters_.reserve(size);
+        }
       },
-      [this](Stats::Counter& counter) {
-        snapped_counters_.push_back(Stats::CounterSharedPtr(&counter));
-        counters_.push_back({counter.latch(), counter});
+      [this, changed_only](Stats::Counter& counter) {
+        // Every counter must be latched, whether or not it is included.
+        const uint64_t delta = counter.latch();
+        if (!changed_only || delta > 0) {
+          snapped_counters_.push_back(Stats::CounterSharedPtr(&counter));
+          counters_.push_back({delta, counter});
+        }
       });
 
   store.forEachSinkedGauge(
-      [this](std::size_t size) {
-        snapped_gauges_.reserve(size);
-        gauges_.reserve(size);
+      [this, changed_only](std::size_t size) {
+        if (!changed_only) {
+          snapped_gauges_.reserve(size);
+          gauges_.reserve(size);
+        }
       },
-      [this](Stats::Gauge& gauge) {
-        snapped_gauges_.push_back(Stats::GaugeSharedPtr(&gauge));
-        gauges_.push_back(gauge);
+      [this, changed_only](Stats::Gauge& gauge) {
+        if (!changed_only || gauge.latchChanged()) {
+          snapped_gauges_.push_back(Stats::GaugeSharedPtr(&gauge));
+          gauges_.push_back(gauge);
+        }
       });
 
   store.forEachSinkedHistogram(
-      [this](std::size_t size) {
-        snapped_histograms_.reserve(size);
-        histograms_.reserve(size);
+      [this, changed_only](std::size_t size) {
+        if (!changed_only) {
+          snapped_histograms_.reserve(size);
+          histograms_.reserve(size);
+        }
       },
-      [this](Stats::ParentHistogram& histogram) {
-        snapped_histograms_.push_back(Stats::ParentHistogramSharedPtr(&histogram));
-        histograms_.push_back(histogram);
+      [this, changed_only](Stats::ParentHistogram& histogram) {
+        if (!changed_only || histogram.intervalStatistics().sampleCount() > 0) {
+          snapped_histograms_.push_back(Stats::ParentHistogramSharedPtr(&histogram));
+          histograms_.push_back(histogram);
+        }
       });
 
   store.forEachSinkedTextReadout(
-      [this](std::size_t size) {
-        snapped_text_readouts_.reserve(size);
-        text_readouts_.reserve(size);
+      [this, changed_only](std::size_t size) {
+        if (!changed_only) {
+          snapped_text_readouts_.reserve(size);
+          text_readouts_.reserve(size);
+        }
       },
-      [this](Stats::TextReadout& text_readout) {
-        snapped_text_readouts_.push_back(Stats::TextReadoutSharedPtr(&text_readout));
-        text_readouts_.push_back(text_readout);
+      [this, changed_only](Stats::TextReadout& text_readout) {
+        if (!changed_only || text_readout.latchChanged()) {
+          snapped_text_readouts_.push_back(Stats::TextReadoutSharedPtr(&text_readout));
+          text_readouts_.push_back(text_readout);
+        }
       });
 
   Upstream::HostUtility::forEachHostMetric(
       cluster_manager,
-      [this](Stats::PrimitiveCounterSnapshot&& metric) {
-        host_counters_.emplace_back(std::move(metric));
+      [this, changed_only](Stats::PrimitiveCounterSnapshot&& metric) {
+        if (!changed_only || metric.delta() > 0) {
+          host_counters_.emplace_back(std::move(metric));
+        }
       },
       [this](Stats::PrimitiveGaugeSnapshot&& metric) {
         host_gauges_.emplace_back(std::move(metric));
@@ -224,12 +247,13 @@ MetricSnapshotImpl::MetricSnapshotImpl(Stats::Store& store,
 }
 
 void InstanceUtil::flushMetricsToSinks(const std::list<Stats::SinkPtr>& sinks, Stats::Store& store,
-                                       Upstream::ClusterManager& cm, TimeSource& time_source) {
+                                       Upstream::ClusterManager& cm, TimeSource& time_source,
+                                       bool changed_only) {
   // Create a snapshot and flush to all sinks.
   // NOTE: Even if there are no sinks, creating the snapshot has the important property that it
   //       latches all counters on a periodic basis. The hot restart code assumes this is being
   //       done so this should not be removed.
-  MetricSnapshotImpl snapshot(store, cm, time_source);
+  MetricSnapshotImpl snapshot(store, cm, time_source, changed_only);
   for (const auto& sink : sinks) {
     sink->flush(snapshot);
   }
@@ -291,7 +315,7 @@ void InstanceBase::flushStatsInternal() {
   updateServerStats();
   auto& stats_config = config_.statsConfig();
   InstanceUtil::flushMetricsToSinks(stats_config.sinks(), stats_store_, clusterManager(),
-                                    timeSource());
+                                    timeSource(), stats_config.flushChangedOnly());
   if (const auto evict_on_flush = stats_config.evictOnFlush(); evict_on_flush > 0) {
     stats_eviction_counter_ = (stats_eviction_counter_ + 1) % evict_on_flush;
     if (stats_eviction_counter_ == 0) {
@@ -550,6 +574,11 @@ absl::Status InstanceBase::initializeOrThrow(Network::Address::InstanceConstShar
       bootstrap_.stats_config(), stats_store_.symbolTable(), server_contexts_));
   stats_store_.setHistogramSettings(
       std::make_unique<Stats::HistogramSettingsImpl>(bootstrap_.stats_config(), server_contexts_));
+  stats_store_.setHistogramMergeThreads(
+      api_->threadFactory(),
+      PROTOBUF_GET_WRAPPED_OR_DEFAULT(bootstrap_.stats_config(), histogram_merge_threads, 0));
+  stats_store_.setShardedCounters({bootstrap_.stats_config().sharded_counters().begin(),
+                                   bootstrap_.stats_config().sharded_counters().end()});
 
   const std::string server_stats_prefix = "server.";
   const std::string server_compilation_settings_stats_prefix = "server.compilation_settings";
@@ -659,6 +688,9 @@ absl::Status InstanceBase::initializeOrThrow(Network::Address::InstanceConstShar
 
   loadServerFlags(initial_config.flagsPath());
 
+  Buffer::WatermarkBufferFactory::configureSliceStoragePool(
+      bootstrap_.overload_manager().buffer_factory_config());
+
   // Initialize the overload manager early so other modules can register for actions.
   auto overload_manager_or_error = createOverloadManager();
   RETURN_IF_NOT_OK(overload_manager_or_error.status());
@@ -132,9 +132,12 @@ public:
    * flush() on each sink.
    * @param sinks supplies the list of sinks.
    * @param store provides the store being flushed.
+   * @param changed_only if true, only metrics that changed since the previous flush are passed
+   *        to the sinks.
    */
   static void flushMetricsToSinks(const std::list<Stats::SinkPtr>& sinks, Stats::Store& store,
-                                  Upstream::ClusterManager& cm, TimeSource& time_source);
+                                  Upstream::ClusterManager& cm, TimeSource& time_source,
+                                  bool changed_only = false);
 
   /**
    * Load a bootstrap config and perform validation.
@@ -471,9 +474,12 @@ private:
 class MetricSnapshotImpl : public Stats::MetricSnapshot {
 public:
   // MetricSnapshotImpl captures a snapshot of metrics by latching the delta usage, and optionally
-  // marking the stats as used.
+  // marking the stats as used. If changed_only is set, the snapshot only includes counters with a
+  // non-zero delta, gauges and text readouts written since the previous snapshot, and histograms
+  // with samples in the current interval. Host gauges are not change-tracked, and are always
+  // included.
   explicit MetricSnapshotImpl(Stats::Store& store, Upstream::ClusterManager& cluster_manager,
-                              TimeSource& time_source);
+                              TimeSource& time_source, bool changed_only = false);
 
   // Stats::MetricSnapshot
   const std::vector<CounterSnapshot>& counters() override { return counters_; }
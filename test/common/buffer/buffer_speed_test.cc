@@ -558,4 +558,38 @@ BENCHMARK(bufferAddVsAddFragments)
     ->Args({1, 1, 64, 5})
     ->Args({1, 1, 4096, 5});
 
+// Measure churn of buffers mixing small header-sized and large body-sized slices, as seen when
+// proxying requests. range(0) is the number of blocks the slice storage pool may cache per size
+// class; 0 disables the pool so every slice allocation goes to the heap.
+static void bufferMixedSizeChurn(benchmark::State& state) {
+  Buffer::SliceStoragePool::setLimits(state.range(0),
+                                      Buffer::SliceStoragePool::DefaultMaxCachedBytes);
+  Buffer::SliceStoragePool::clearThreadCacheForTest();
+  const std::string headers(700, 'h');
+  const std::string body(40000, 'b');
+  const std::string trailers(100, 't');
+  for (auto _ : state) {
+    UNREFERENCED_PARAMETER(_);
+    Buffer::OwnedImpl request;
+    request.appendSliceForTest(headers);
+    request.appendSliceForTest(body);
+    Buffer::OwnedImpl response;
+    response.appendSliceForTest(headers);
+    response.appendSliceForTest(body);
+    response.appendSliceForTest(trailers);
+    response.move(request);
+    benchmark::DoNotOptimize(response.length());
+  }
+  const auto& stats = Buffer::SliceStoragePool::threadStats();
+  state.counters["heap_allocs_per_iter"] =
+      benchmark::Counter(stats.misses_, benchmark::Counter::kAvgIterations);
+  state.counters["pool_hit_ratio"] =
+      stats.hits_ + stats.misses_ == 0
+          ? 0
+          : static_cast<double>(stats.hits_) / (stats.hits_ + stats.misses_);
+  Buffer::SliceStoragePool::setLimits(Buffer::SliceStoragePool::DefaultMaxBlocksPerClass,
+                                      Buffer::SliceStoragePool::DefaultMaxCachedBytes);
+}
+BENCHMARK(bufferMixedSizeChurn)->Arg(0)->Arg(1)->Arg(8);
+
 } // namespace Envoy
@@ -581,6 +581,38 @@ TEST_F(OwnedImplTest, PartialMoveDrainTrackers) {
   buffer2.drain(buffer2.length());
 }
 
+TEST_F(OwnedImplTest, MoveSlicesKeepsStorage) {
+  testing::InSequence s;
+
+  Buffer::OwnedImpl buffer1;
+  Buffer::OwnedImpl buffer2;
+  buffer2.add("b");
+  testing::MockFunction<void()> tracker1;
+  buffer2.addDrainTracker(tracker1.AsStdFunction());
+
+  buffer2.add(std::string(10000, 'c'));
+  testing::MockFunction<void()> tracker2;
+  buffer2.addDrainTracker(tracker2.AsStdFunction());
+  const auto slices = buffer2.getRawSlices();
+  ASSERT_EQ(2, slices.size());
+
+  // Both slices are moved without being coalesced, and the unmoved tail of the second one is
+  // copied back to buffer2.
+  testing::MockFunction<void()> done;
+  EXPECT_CALL(tracker1, Call());
+  EXPECT_CALL(tracker2, Call());
+  EXPECT_CALL(done, Call());
+  buffer1.moveSlices(buffer2, 4001);
+  done.Call();
+
+  const auto moved_slices = buffer1.getRawSlices();
+  ASSERT_EQ(2, moved_slices.size());
+  EXPECT_EQ(slices[0].mem_, moved_slices[0].mem_);
+  EXPECT_EQ(slices[1].mem_, moved_slices[1].mem_);
+  EXPECT_EQ(10001, buffer1.length());
+  EXPECT_EQ(std::string(6000, 'c'), buffer2.toString());
+}
+
 TEST_F(OwnedImplTest, DrainTrackingOnDestruction) {
   testing::InSequence s;
 
@@ -894,6 +926,7 @@ TEST_F(OwnedImplTest, ReserveSingleOverCommit) {
 
 // Test functionality of the `freelist` (a performance optimization).
 TEST_F(OwnedImplTest, SliceFreeList) {
+  Buffer::SliceStoragePool::clearThreadCacheForTest();
   Buffer::OwnedImpl b1, b2;
   std::vector<void*> slices;
   {
@@ -912,16 +945,18 @@ TEST_F(OwnedImplTest, SliceFreeList) {
     EXPECT_EQ(slices[1], b2.getRawSlices()[0].mem_);
   }
 
+  // Draining the slice returns its storage to the free list, ahead of the unused reservations.
   b1.drain(1);
   EXPECT_EQ(0, b1.getRawSlices().size());
   {
     auto r = b2.reserveForRead();
     // slices()[0] is the partially used slice that is already part of this buffer.
-    EXPECT_EQ(slices[2], r.slices()[1].mem_);
+    EXPECT_EQ(slices[0], r.slices()[1].mem_);
+    EXPECT_EQ(slices[2], r.slices()[2].mem_);
   }
   {
     auto r = b1.reserveForRead();
-    EXPECT_EQ(slices[2], r.slices()[0].mem_);
+    EXPECT_EQ(slices[0], r.slices()[0].mem_);
   }
   {
     // This causes an underflow in the `freelist` on creation, and overflows it on deletion.
@@ -938,6 +973,82 @@ TEST_F(OwnedImplTest, SliceFreeList) {
   }
 }
 
+// Storage of every page-multiple size up to the largest size class is recycled, not only the
+// default slice size used for read reservations.
+TEST_F(OwnedImplTest, SliceStoragePoolSizeClasses) {
+  Buffer::SliceStoragePool::clearThreadCacheForTest();
+  const auto& stats = Buffer::SliceStoragePool::threadStats();
+
+  const void* small_storage;
+  const void* large_storage;
+  {
+    Buffer::OwnedImpl buffer;
+    buffer.appendSliceForTest(std::string(100, 'a'));
+    buffer.appendSliceForTest(std::string(5000, 'b'));
+    small_storage = buffer.getRawSlices()[0].mem_;
+    large_storage = buffer.getRawSlices()[1].mem_;
+    EXPECT_EQ(2, stats.misses_);
+  }
+  EXPECT_EQ(2, stats.recycled_);
+  EXPECT_EQ(4096 + 8192, Buffer::SliceStoragePool::threadCachedBytes());
+
+  {
+    Buffer::OwnedImpl buffer;
+    buffer.appendSliceForTest(std::string(6000, 'c'));
+    buffer.appendSliceForTest(std::string(10, 'd'));
+    EXPECT_EQ(large_storage, buffer.getRawSlices()[0].mem_);
+    EXPECT_EQ(small_storage, buffer.getRawSlices()[1].mem_);
+    EXPECT_EQ(2, stats.hits_);
+    EXPECT_EQ(0, Buffer::SliceStoragePool::threadCachedBytes());
+  }
+
+  // Storage larger than the largest size class always goes back to the heap.
+  {
+    Buffer::OwnedImpl buffer;
+    buffer.appendSliceForTest(std::string(Buffer::SliceStoragePool::MaxPooledSize + 1, 'e'));
+  }
+  EXPECT_EQ(1, stats.overflows_);
+  EXPECT_EQ(4096 + 8192, Buffer::SliceStoragePool::threadCachedBytes());
+}
+
+TEST_F(OwnedImplTest, SliceStoragePoolLimits) {
+  Buffer::SliceStoragePool::clearThreadCacheForTest();
+  const auto& stats = Buffer::SliceStoragePool::threadStats();
+
+  // Only one block per size class may be cached.
+  Buffer::SliceStoragePool::setLimits(1, Buffer::SliceStoragePool::DefaultMaxCachedBytes);
+  {
+    Buffer::OwnedImpl buffer;
+    buffer.appendSliceForTest("a");
+    buffer.appendSliceForTest("b");
+  }
+  EXPECT_EQ(1, stats.recycled_);
+  EXPECT_EQ(1, stats.overflows_);
+  EXPECT_EQ(4096, Buffer::SliceStoragePool::threadCachedBytes());
+
+  // The byte limit applies across size classes.
+  Buffer::SliceStoragePool::setLimits(Buffer::SliceStoragePool::DefaultMaxBlocksPerClass, 8192);
+  {
+    Buffer::OwnedImpl buffer;
+    buffer.appendSliceForTest(std::string(5000, 'a'));
+  }
+  EXPECT_EQ(2, stats.overflows_);
+  EXPECT_EQ(4096, Buffer::SliceStoragePool::threadCachedBytes());
+
+  // A zero block limit disables the cache.
+  Buffer::SliceStoragePool::clearThreadCacheForTest();
+  Buffer::SliceStoragePool::setLimits(0, Buffer::SliceStoragePool::DefaultMaxCachedBytes);
+  {
+    Buffer::OwnedImpl buffer;
+    buffer.appendSliceForTest("a");
+  }
+  EXPECT_EQ(0, stats.recycled_);
+  EXPECT_EQ(0, Buffer::SliceStoragePool::threadCachedBytes());
+
+  Buffer::SliceStoragePool::setLimits(Buffer::SliceStoragePool::DefaultMaxBlocksPerClass,
+                                      Buffer::SliceStoragePool::DefaultMaxCachedBytes);
+}
+
 TEST_F(OwnedImplTest, Search) {
   // Populate a buffer with a string split across many small slices, to
   // exercise edge cases in the search implementation.
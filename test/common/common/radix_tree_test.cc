@@ -127,12 +127,14 @@ TEST(RadixTree, EmptyAndSingleNode) {
   const char* cstr_a = "a";
 
   // Test empty radixtree
+  EXPECT_TRUE(radixtree.empty());
   EXPECT_EQ(nullptr, radixtree.find("anything"));
   EXPECT_EQ(nullptr, radixtree.findLongestPrefix("anything"));
   EXPECT_THAT(radixtree.findMatchingPrefixes("anything"), ElementsAre());
 
   // Test single node
   EXPECT_TRUE(radixtree.add(std::string("a"), cstr_a));
+  EXPECT_FALSE(radixtree.empty());
   EXPECT_EQ(cstr_a, radixtree.find("a"));
   EXPECT_EQ(cstr_a, radixtree.findLongestPrefix("a"));
   EXPECT_THAT(radixtree.findMatchingPrefixes("a"), ElementsAre(cstr_a));
@@ -150,6 +152,7 @@ TEST(RadixTree, InsertAndFindEdgeCases) {
 
   // Test empty string
   EXPECT_TRUE(radixtree.add(std::string(""), cstr_a));
+  EXPECT_FALSE(radixtree.empty());
   EXPECT_EQ(cstr_a, radixtree.find(""));
   EXPECT_EQ(cstr_a, radixtree.findLongestPrefix(""));
   EXPECT_THAT(radixtree.findMatchingPrefixes(""), ElementsAre(cstr_a));
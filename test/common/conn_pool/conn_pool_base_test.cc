@@ -688,5 +688,191 @@ TEST_F(ConnPoolImplDispatcherBaseTest, PoolDrainsWithEarlyDataStreams) {
   closeStream();
 }
 
+TEST(AdaptivePreconnectEstimatorTest, TracksArrivalRateAndConnectLatency) {
+  AdaptivePreconnectEstimator estimator(std::chrono::milliseconds(1000));
+  MonotonicTime now;
+
+  // Nothing is anticipated until a connect latency has been observed.
+  estimator.onStreamArrival(now);
+  EXPECT_EQ(0U, estimator.anticipatedStreams(now));
+
+  // After ten windows of 100 streams per second, the estimate has converged on that rate.
+  for (int i = 0; i < 1000; ++i) {
+    now += std::chrono::milliseconds(10);
+    estimator.onStreamArrival(now);
+  }
+  EXPECT_NEAR(100, estimator.arrivalRate(now), 1);
+
+  estimator.onConnectLatency(std::chrono::milliseconds(20));
+  EXPECT_EQ(2U, estimator.anticipatedStreams(now));
+
+  // Later latency samples are smoothed: 20ms + (100ms - 20ms) / 8 = 30ms.
+  estimator.onConnectLatency(std::chrono::milliseconds(100));
+  EXPECT_EQ(3U, estimator.anticipatedStreams(now));
+
+  // The rate decays once streams stop arriving.
+  now += std::chrono::seconds(10);
+  EXPECT_NEAR(0, estimator.arrivalRate(now), 0.01);
+  EXPECT_EQ(0U, estimator.anticipatedStreams(now));
+}
+
+// Drives a pool with a simulated load, where each connection takes a fixed time to establish and
+// each stream holds its connection for a fixed time.
+class ConnPoolImplAdaptivePreconnectTest : public testing::Test {
+public:
+  void initialize(absl::optional<std::chrono::milliseconds> adaptive_preconnect_window) {
+    cluster_->resetResourceManager(1024, 1024, 1024, 1, 1);
+    ON_CALL(*cluster_, adaptivePreconnectWindow())
+        .WillByDefault(Return(adaptive_preconnect_window));
+    // The pool takes ownership of the callback.
+    new NiceMock<Event::MockSchedulableCallback>(&dispatcher_);
+    pool_ = std::make_unique<NiceMock<TestConnPoolImplBase>>(
+        host_, Upstream::ResourcePriority::Default, dispatcher_, nullptr, nullptr, state_,
+        overload_manager_);
+    ON_CALL(*pool_, instantiateActiveClient).WillByDefault(Invoke([&]() -> ActiveClientPtr {
+      auto ret = std::make_unique<NiceMock<TestActiveClient>>(
+          *pool_, /*lifetime_stream_limit=*/0, /*concurrent_stream_limit=*/1,
+          /*supports_early_data=*/false);
+      ret->real_host_description_ = descr_;
+      connecting_.emplace_back(ret.get(), time_system_.monotonicTime() + connect_latency_);
+      ++connections_;
+      return ret;
+    }));
+    ON_CALL(*pool_, onPoolReady)
+        .WillByDefault(Invoke([&](ActiveClient& client, AttachContext&) {
+          TestActiveClient::incrementActiveStreams(client);
+          streams_.emplace_back(dynamic_cast<TestActiveClient*>(&client),
+                                time_system_.monotonicTime() + stream_duration_);
+        }));
+  }
+
+  // Issues a stream, returning true if it was queued waiting for a connection.
+  bool newStream() {
+    return pool_->newStreamImpl(context_, /*can_send_early_data=*/false) != nullptr;
+  }
+
+  // Advances time a millisecond at a time, establishing connections and completing streams as
+  // they become due.
+  void advance(std::chrono::milliseconds duration) {
+    for (std::chrono::milliseconds elapsed(0); elapsed < duration; ++elapsed) {
+      time_system_.advanceTimeWait(std::chrono::milliseconds(1));
+      const MonotonicTime now = time_system_.monotonicTime();
+
+      // Connecting may create more connections, and completing streams may attach pending
+      // streams, so work from a copy of each list.
+      std::vector<std::pair<TestActiveClient*, MonotonicTime>> connecting;
+      connecting.swap(connecting_);
+      for (const auto& [client, connected_at] : connecting) {
+        if (connected_at > now) {
+          connecting_.emplace_back(client, connected_at);
+          continue;
+        }
+        client->onEvent(Network::ConnectionEvent::Connected);
+      }
+
+      std::vector<std::pair<TestActiveClient*, MonotonicTime>> streams;
+      streams.swap(streams_);
+      for (const auto& [client, completed_at] : streams) {
+        if (completed_at > now) {
+          streams_.emplace_back(client, completed_at);
+          continue;
+        }
+        --client->active_streams_;
+        pool_->onStreamClosed(*client, false);
+      }
+    }
+  }
+
+  // Establishes the first connection, then issues a stream every 5ms for 5 seconds. Connections
+  // take 20ms to establish, so 4 streams are expected to arrive during each connection
+  // establishment.
+  void warmUp() {
+    newStream();
+    advance(std::chrono::milliseconds(25));
+    for (int i = 0; i < 1000; ++i) {
+      EXPECT_FALSE(newStream());
+      advance(std::chrono::milliseconds(5));
+    }
+  }
+
+  // Issues `count` long lived streams at once, returning how many were queued.
+  uint32_t burst(uint32_t count) {
+    stream_duration_ = std::chrono::milliseconds(100);
+    uint32_t queued = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+      if (newStream()) {
+        ++queued;
+      }
+    }
+    advance(std::chrono::milliseconds(150));
+    return queued;
+  }
+
+  void tearDown() {
+    EXPECT_TRUE(streams_.empty());
+    pool_->drainConnectionsImpl(Envoy::ConnectionPool::DrainBehavior::DrainAndDelete);
+    pool_->destructAllConnections();
+  }
+
+  Event::SimulatedTimeSystem time_system_;
+  std::chrono::milliseconds connect_latency_{20};
+  std::chrono::milliseconds stream_duration_{1};
+  std::vector<std::pair<TestActiveClient*, MonotonicTime>> connecting_;
+  std::vector<std::pair<TestActiveClient*, MonotonicTime>> streams_;
+  uint32_t connections_{0};
+  Upstream::ClusterConnectivityState state_;
+  std::shared_ptr<NiceMock<Upstream::MockHostDescription>> descr_{
+      new NiceMock<Upstream::MockHostDescription>()};
+  std::shared_ptr<Upstream::MockClusterInfo> cluster_{new NiceMock<Upstream::MockClusterInfo>()};
+  NiceMock<Event::MockDispatcher> dispatcher_;
+  NiceMock<Server::MockOverloadManager> overload_manager_;
+  Upstream::HostSharedPtr host_{Upstream::makeTestHost(cluster_, "tcp://127.0.0.1:80")};
+  std::unique_ptr<NiceMock<TestConnPoolImplBase>> pool_;
+  AttachContext context_;
+};
+
+// Without adaptive preconnecting a single connection serves the steady load, so all but one
+// stream of a burst waits for a new connection.
+TEST_F(ConnPoolImplAdaptivePreconnectTest, ReactivePoolQueuesBurst) {
+  initialize(absl::nullopt);
+  warmUp();
+  EXPECT_EQ(1U, connections_);
+
+  EXPECT_EQ(3U, burst(4));
+  EXPECT_EQ(0U, cluster_->traffic_stats_->upstream_cx_preconnect_adaptive_.value());
+  tearDown();
+}
+
+// With adaptive preconnecting the pool keeps capacity for the 4 streams expected per connection
+// establishment warm, so the same burst is served without queueing.
+TEST_F(ConnPoolImplAdaptivePreconnectTest, WarmPoolServesBurst) {
+  initialize(std::chrono::milliseconds(1000));
+  warmUp();
+  // The first connection was created for the first stream, and the rest were predicted.
+  EXPECT_EQ(5U, connections_);
+  EXPECT_EQ(4U, cluster_->traffic_stats_->upstream_cx_preconnect_adaptive_.value());
+
+  EXPECT_EQ(0U, burst(4));
+  // Capacity is replenished as the burst consumes it.
+  EXPECT_LT(5U, connections_);
+  EXPECT_EQ(connections_ - 1,
+            cluster_->traffic_stats_->upstream_cx_preconnect_adaptive_.value());
+  tearDown();
+
+  // Connections preconnected for the burst's follow-up traffic, which never came, are counted as
+  // unused.
+  EXPECT_LT(0U, cluster_->traffic_stats_->upstream_cx_preconnect_adaptive_unused_.value());
+}
+
+// Adaptive preconnecting is not done for unhealthy upstreams.
+TEST_F(ConnPoolImplAdaptivePreconnectTest, NoAdaptivePreconnectIfUnhealthy) {
+  initialize(std::chrono::milliseconds(1000));
+  host_->healthFlagSet(Upstream::Host::HealthFlag::FAILED_ACTIVE_HC);
+  warmUp();
+  EXPECT_EQ(1U, connections_);
+  EXPECT_EQ(0U, cluster_->traffic_stats_->upstream_cx_preconnect_adaptive_.value());
+  tearDown();
+}
+
 } // namespace ConnectionPool
 } // namespace Envoy
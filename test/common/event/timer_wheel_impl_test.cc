@@ -0,0 +1,173 @@
+#include <chrono>
+
+#include "source/common/event/dispatcher_impl.h"
+#include "source/common/event/scaled_range_timer_manager_impl.h"
+#include "source/common/event/timer_wheel_impl.h"
+
+#include "test/mocks/common.h"
+#include "test/test_common/simulated_time_system.h"
+#include "test/test_common/utility.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Event {
+namespace {
+
+using testing::MockFunction;
+
+class TimerWheelTest : public testing::Test {
+public:
+  TimerWheelTest()
+      : api_(Api::createApiForTest(time_system_)),
+        dispatcher_(std::make_unique<DispatcherImpl>(
+            "test_thread", *api_, time_system_,
+            [](Dispatcher& dispatcher) {
+              return std::make_unique<ScaledRangeTimerManagerImpl>(dispatcher);
+            },
+            nullptr, TimerWheelConfig{std::chrono::milliseconds(10), 8})) {}
+
+  void advance(std::chrono::milliseconds duration) {
+    time_system_.advanceTimeAndRun(duration, *dispatcher_, Dispatcher::RunType::NonBlock);
+  }
+
+  Event::SimulatedTimeSystem time_system_;
+  Api::ApiPtr api_;
+  DispatcherPtr dispatcher_;
+};
+
+TEST_F(TimerWheelTest, ExpiresAtMostOneTickLate) {
+  MockFunction<void()> callback;
+  TimerPtr timer = dispatcher_->createTimer(callback.AsStdFunction());
+  timer->enableTimer(std::chrono::milliseconds(25));
+  EXPECT_TRUE(timer->enabled());
+
+  EXPECT_CALL(callback, Call()).Times(0);
+  advance(std::chrono::milliseconds(24));
+  EXPECT_TRUE(timer->enabled());
+
+  EXPECT_CALL(callback, Call());
+  advance(std::chrono::milliseconds(10));
+  EXPECT_FALSE(timer->enabled());
+}
+
+TEST_F(TimerWheelTest, Disable) {
+  MockFunction<void()> callback;
+  TimerPtr timer = dispatcher_->createTimer(callback.AsStdFunction());
+  timer->enableTimer(std::chrono::milliseconds(20));
+  timer->disableTimer();
+  EXPECT_FALSE(timer->enabled());
+
+  EXPECT_CALL(callback, Call()).Times(0);
+  advance(std::chrono::milliseconds(100));
+}
+
+TEST_F(TimerWheelTest, Reenable) {
+  MockFunction<void()> callback;
+  TimerPtr timer = dispatcher_->createTimer(callback.AsStdFunction());
+  timer->enableTimer(std::chrono::milliseconds(20));
+  advance(std::chrono::milliseconds(10));
+  timer->enableTimer(std::chrono::milliseconds(50));
+
+  EXPECT_CALL(callback, Call()).Times(0);
+  advance(std::chrono::milliseconds(40));
+
+  EXPECT_CALL(callback, Call());
+  advance(std::chrono::milliseconds(20));
+}
+
+// Timers further than the span of the wheel skip the slot until they are due.
+TEST_F(TimerWheelTest, LongerThanWheel) {
+  MockFunction<void()> callback;
+  TimerPtr timer = dispatcher_->createTimer(callback.AsStdFunction());
+  timer->enableTimer(std::chrono::milliseconds(200));
+
+  EXPECT_CALL(callback, Call()).Times(0);
+  for (int i = 0; i < 19; ++i) {
+    advance(std::chrono::milliseconds(10));
+  }
+
+  EXPECT_CALL(callback, Call());
+  advance(std::chrono::milliseconds(20));
+}
+
+// All the expired timers fire even if the wheel is driven late.
+TEST_F(TimerWheelTest, LateTick) {
+  MockFunction<void()> callback1;
+  MockFunction<void()> callback2;
+  TimerPtr timer1 = dispatcher_->createTimer(callback1.AsStdFunction());
+  TimerPtr timer2 = dispatcher_->createTimer(callback2.AsStdFunction());
+  timer1->enableTimer(std::chrono::milliseconds(10));
+  timer2->enableTimer(std::chrono::milliseconds(150));
+
+  EXPECT_CALL(callback1, Call());
+  EXPECT_CALL(callback2, Call());
+  advance(std::chrono::milliseconds(1000));
+}
+
+// Timeouts shorter than a tick and high resolution timers don't lose precision.
+TEST_F(TimerWheelTest, ShortAndHighResolutionTimers) {
+  MockFunction<void()> callback1;
+  MockFunction<void()> callback2;
+  TimerPtr timer1 = dispatcher_->createTimer(callback1.AsStdFunction());
+  TimerPtr timer2 = dispatcher_->createTimer(callback2.AsStdFunction());
+  timer1->enableTimer(std::chrono::milliseconds(3));
+  timer2->enableHRTimer(std::chrono::microseconds(12500));
+  EXPECT_TRUE(timer1->enabled());
+  EXPECT_TRUE(timer2->enabled());
+
+  EXPECT_CALL(callback1, Call());
+  advance(std::chrono::milliseconds(3));
+  EXPECT_FALSE(timer1->enabled());
+
+  EXPECT_CALL(callback2, Call()).Times(0);
+  advance(std::chrono::milliseconds(9));
+  EXPECT_CALL(callback2, Call());
+  advance(std::chrono::milliseconds(1));
+  EXPECT_FALSE(timer2->enabled());
+}
+
+// A callback may destroy or re-enable the other timers expiring on the same tick.
+TEST_F(TimerWheelTest, CallbackModifiesExpiredTimers) {
+  TimerPtr timer1;
+  TimerPtr timer2;
+  TimerPtr timer3;
+  MockFunction<void()> callback2;
+  MockFunction<void()> callback3;
+  timer1 = dispatcher_->createTimer([&]() {
+    timer2.reset();
+    timer3->enableTimer(std::chrono::milliseconds(30));
+  });
+  timer2 = dispatcher_->createTimer(callback2.AsStdFunction());
+  timer3 = dispatcher_->createTimer(callback3.AsStdFunction());
+  // Timers expiring on the same tick fire in the order they were enabled.
+  timer1->enableTimer(std::chrono::milliseconds(20));
+  timer2->enableTimer(std::chrono::milliseconds(20));
+  timer3->enableTimer(std::chrono::milliseconds(20));
+
+  EXPECT_CALL(callback2, Call()).Times(0);
+  EXPECT_CALL(callback3, Call()).Times(0);
+  advance(std::chrono::milliseconds(20));
+  EXPECT_EQ(nullptr, timer2);
+  EXPECT_TRUE(timer3->enabled());
+
+  EXPECT_CALL(callback3, Call());
+  advance(std::chrono::milliseconds(40));
+}
+
+TEST_F(TimerWheelTest, ScopeTracking) {
+  MockScopeTrackedObject scope;
+  const ScopeTrackedObject* tracked = nullptr;
+  TimerPtr timer = dispatcher_->createTimer([&]() {
+    tracked = &scope;
+    EXPECT_FALSE(dispatcher_->trackedObjectStackIsEmpty());
+  });
+  timer->enableTimer(std::chrono::milliseconds(10), &scope);
+  advance(std::chrono::milliseconds(20));
+  EXPECT_EQ(&scope, tracked);
+  EXPECT_TRUE(dispatcher_->trackedObjectStackIsEmpty());
+}
+
+} // namespace
+} // namespace Event
+} // namespace Envoy
@@ -0,0 +1,89 @@
+// Note: this should be run with --compilation_mode=opt, and would benefit from a
+// quiescent system with disabled cstate power management.
+
+#include <chrono>
+#include <vector>
+
+#include "source/common/event/dispatcher_impl.h"
+#include "source/common/event/real_time_system.h"
+#include "source/common/event/scaled_range_timer_manager_impl.h"
+#include "source/common/event/timer_wheel_impl.h"
+
+#include "test/test_common/utility.h"
+
+#include "absl/types/optional.h"
+#include "benchmark/benchmark.h"
+
+namespace Envoy {
+namespace Event {
+
+namespace {
+
+// Holds a dispatcher using either the libevent timers or a timer wheel, and a set of its timers.
+class TimerBenchmarkFixture {
+public:
+  TimerBenchmarkFixture(bool timer_wheel, int64_t num_timers)
+      : api_(Api::createApiForTest(time_system_)),
+        dispatcher_(std::make_unique<DispatcherImpl>(
+            "test_thread", *api_, time_system_,
+            [](Dispatcher& dispatcher) {
+              return std::make_unique<ScaledRangeTimerManagerImpl>(dispatcher);
+            },
+            nullptr,
+            timer_wheel
+                ? absl::make_optional(TimerWheelConfig{std::chrono::milliseconds(10), 4096})
+                : absl::nullopt)) {
+    timers_.reserve(num_timers);
+    for (int64_t i = 0; i < num_timers; ++i) {
+      timers_.push_back(dispatcher_->createTimer([]() {}));
+    }
+  }
+
+  // Spreads the timeouts between 30 and 90 seconds, like the idle timeouts of connections created
+  // at different times.
+  static std::chrono::milliseconds timeout(size_t i) {
+    return std::chrono::milliseconds(30000 + (i * 7919) % 60000);
+  }
+
+  RealTimeSystem time_system_;
+  Api::ApiPtr api_;
+  DispatcherPtr dispatcher_;
+  std::vector<TimerPtr> timers_;
+};
+
+} // namespace
+
+// Arms and disarms timers while many others are pending, e.g. a stream timeout for each request
+// on a worker holding many connections.
+static void bmArmDisarm(benchmark::State& state) {
+  TimerBenchmarkFixture fixture(state.range(0), state.range(1));
+  for (size_t i = 0; i < fixture.timers_.size(); ++i) {
+    fixture.timers_[i]->enableTimer(TimerBenchmarkFixture::timeout(i));
+  }
+  TimerPtr timer = fixture.dispatcher_->createTimer([]() {});
+  size_t i = 0;
+  for (auto _ : state) { // NOLINT
+    timer->enableTimer(TimerBenchmarkFixture::timeout(i++));
+    timer->disableTimer();
+  }
+}
+BENCHMARK(bmArmDisarm)
+    ->ArgsProduct({{0, 1}, {1000, 100000, 500000}})
+    ->Unit(benchmark::kNanosecond);
+
+// Re-arms pending timers, e.g. resetting the idle timeout of a connection on each read.
+static void bmRearm(benchmark::State& state) {
+  TimerBenchmarkFixture fixture(state.range(0), state.range(1));
+  for (size_t i = 0; i < fixture.timers_.size(); ++i) {
+    fixture.timers_[i]->enableTimer(TimerBenchmarkFixture::timeout(i));
+  }
+  size_t i = 0;
+  for (auto _ : state) { // NOLINT
+    const size_t index = i++ % fixture.timers_.size();
+    fixture.timers_[index]->enableTimer(TimerBenchmarkFixture::timeout(i));
+  }
+}
+BENCHMARK(bmRearm)->ArgsProduct({{0, 1}, {1000, 100000, 500000}})->Unit(benchmark::kNanosecond);
+
+} // namespace Event
+} // namespace Envoy
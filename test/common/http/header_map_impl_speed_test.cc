@@ -210,6 +210,49 @@ static void headerMapImplPopulate(benchmark::State& state) {
 }
 BENCHMARK(headerMapImplPopulate);
 
+/**
+ * Measure the speed of populating a RequestHeaderMapImpl the way a codec does with decoded
+ * request headers, then reading the O(1) headers that routing uses. When state.range(0) is
+ * non-zero the headers are added with addCopyDeferred() rather than addViaMove().
+ */
+static void headerMapImplDecodeAndRoute(benchmark::State& state) {
+  const std::pair<std::string, std::string> decoded_headers[] = {
+      {":method", "GET"},
+      {":scheme", "https"},
+      {":authority", "www.example.com"},
+      {":path", "/index.html"},
+      {"user-agent", "Mozilla/5.0 (X11; Linux x86_64; rv:109.0) Gecko/20100101 Firefox/115.0"},
+      {"accept", "text/html,application/xhtml+xml,application/xml;q=0.9,*/*;q=0.8"},
+      {"accept-language", "en-US,en;q=0.5"},
+      {"accept-encoding", "gzip, deflate, br"},
+      {"referer", "https://www.example.com/"},
+      {"sec-fetch-dest", "document"},
+      {"sec-fetch-mode", "navigate"},
+      {"sec-fetch-site", "same-origin"},
+      {"upgrade-insecure-requests", "1"},
+      {"x-request-start", "t=1674446400000"},
+  };
+  const bool deferred = state.range(0) != 0;
+  for (auto _ : state) { // NOLINT
+    auto headers = Http::RequestHeaderMapImpl::create();
+    for (const auto& [key, value] : decoded_headers) {
+      if (deferred) {
+        headers->addCopyDeferred(key, value);
+      } else {
+        HeaderString key_string;
+        key_string.setCopy(key);
+        HeaderString value_string;
+        value_string.setCopy(value);
+        headers->addViaMove(std::move(key_string), std::move(value_string));
+      }
+    }
+    benchmark::DoNotOptimize(headers->getHostValue());
+    benchmark::DoNotOptimize(headers->getPathValue());
+    benchmark::DoNotOptimize(headers->size());
+  }
+}
+BENCHMARK(headerMapImplDecodeAndRoute)->Arg(0)->Arg(1);
+
 /**
  * Measure the speed of encoding headers as part of upgraded requests (HTTP/1 to HTTP/2)
  * @note The measured time for each iteration includes the time needed to add
@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <memory>
+#include <sstream>
 #include <string>
 
 #include "source/common/http/header_list_view.h"
@@ -651,6 +652,152 @@ TEST(HeaderMapImplTest, IterateReverse) {
   });
 }
 
+TEST(HeaderMapImplTest, AddCopyDeferred) {
+  auto headers = RequestHeaderMapImpl::create();
+  headers->addCopyDeferred("hello", "world");
+  headers->addCopyDeferred(":path", "/");
+  headers->addCopyDeferred("user-agent", "envoy");
+  headers->addCopyDeferred("foo", "bar");
+  EXPECT_EQ(4, headers->size());
+  EXPECT_FALSE(headers->empty());
+  EXPECT_EQ(37, headers->byteSize());
+
+  // O(1) headers are available without creating the deferred entries.
+  EXPECT_EQ("/", headers->getPathValue());
+  EXPECT_EQ("envoy", headers->getUserAgentValue());
+
+  // Deferred headers follow the ones that were added eagerly.
+  HeaderAndValueCb cb;
+  {
+    InSequence seq;
+    EXPECT_CALL(cb, Call(":path", "/"));
+    EXPECT_CALL(cb, Call("user-agent", "envoy"));
+    EXPECT_CALL(cb, Call("hello", "world"));
+    EXPECT_CALL(cb, Call("foo", "bar"));
+  }
+  headers->iterate(cb.asIterateCb());
+  headers->verifyByteSizeInternalForTest();
+
+  // Once materialized, headers are added eagerly and the entries can be modified.
+  headers->addCopyDeferred("baz", "qux");
+  headers->get(LowerCaseString("hello"))[0]->value(std::string(200, 'a'));
+  EXPECT_EQ(std::string(200, 'a'),
+            headers->get(LowerCaseString("hello"))[0]->value().getStringView());
+  EXPECT_EQ("qux", headers->get(LowerCaseString("baz"))[0]->value().getStringView());
+  EXPECT_EQ(5, headers->size());
+
+  // Clearing the map allows deferring headers again.
+  headers->clear();
+  EXPECT_TRUE(headers->empty());
+  headers->addCopyDeferred("hello", "again");
+  EXPECT_EQ("again", headers->get(LowerCaseString("hello"))[0]->value().getStringView());
+  EXPECT_EQ(10, headers->byteSize());
+}
+
+TEST(HeaderMapImplTest, AddCopyDeferredMaterializedOnAccess) {
+  {
+    auto headers = RequestHeaderMapImpl::create();
+    headers->addCopyDeferred("hello", "world");
+    headers->addCopyDeferred("foo", "bar");
+    EXPECT_EQ(1, headers->remove(LowerCaseString("foo")));
+    EXPECT_EQ(1, headers->size());
+    EXPECT_EQ(10, headers->byteSize());
+  }
+  {
+    auto headers = RequestHeaderMapImpl::create();
+    headers->addCopyDeferred("hello", "world");
+    headers->appendCopy(LowerCaseString("hello"), "again");
+    EXPECT_EQ("world,again", headers->get(LowerCaseString("hello"))[0]->value().getStringView());
+    EXPECT_EQ(16, headers->byteSize());
+  }
+  {
+    // A header added eagerly after a deferred one keeps the insertion order.
+    auto headers = RequestHeaderMapImpl::create();
+    headers->addCopyDeferred("hello", "world");
+    headers->addCopy(LowerCaseString("foo"), "bar");
+    HeaderAndValueCb cb;
+    {
+      InSequence seq;
+      EXPECT_CALL(cb, Call("hello", "world"));
+      EXPECT_CALL(cb, Call("foo", "bar"));
+    }
+    headers->iterate(cb.asIterateCb());
+  }
+  {
+    auto headers = RequestHeaderMapImpl::create();
+    headers->addCopyDeferred("x-foo", "1");
+    headers->addCopyDeferred("x-bar", "2");
+    EXPECT_EQ(2, headers->removePrefix(LowerCaseString("x-")));
+    EXPECT_TRUE(headers->empty());
+    EXPECT_EQ(0, headers->byteSize());
+  }
+  {
+    auto headers = RequestHeaderMapImpl::create();
+    headers->addCopyDeferred("hello", "world");
+    EXPECT_TRUE(*headers == TestRequestHeaderMapImpl({{"hello", "world"}}));
+  }
+}
+
+TEST(HeaderMapImplTest, IterateForEncoding) {
+  auto headers = RequestHeaderMapImpl::create();
+  headers->addCopyDeferred(":path", "/");
+  headers->addCopyDeferred("hello", "world");
+  headers->addCopyDeferred("foo", "bar");
+
+  HeaderAndValueCb cb;
+  auto key_value_cb = [&cb](const HeaderString& key,
+                            const HeaderString& value) -> HeaderMap::Iterate {
+    // Deferred headers, materialized or not, are never passed as references into the map's
+    // storage.
+    EXPECT_FALSE(value.isReference());
+    cb.Call(std::string(key.getStringView()), std::string(value.getStringView()));
+    return HeaderMap::Iterate::Continue;
+  };
+  {
+    InSequence seq;
+    EXPECT_CALL(cb, Call(":path", "/"));
+    EXPECT_CALL(cb, Call("hello", "world"));
+    EXPECT_CALL(cb, Call("foo", "bar"));
+  }
+  EXPECT_TRUE(headers->iterateForEncoding(key_value_cb));
+  // Modifying an O(1) header keeps the other headers deferred.
+  headers->setPath("/new");
+  {
+    InSequence seq;
+    EXPECT_CALL(cb, Call(":path", "/new"));
+    EXPECT_CALL(cb, Call("hello", "world"));
+    EXPECT_CALL(cb, Call("foo", "bar"));
+  }
+  EXPECT_TRUE(headers->iterateForEncoding(key_value_cb));
+
+  // Accessing a non inline header materializes the deferred headers.
+  headers->remove(LowerCaseString("foo"));
+  {
+    InSequence seq;
+    EXPECT_CALL(cb, Call(":path", "/new"));
+    EXPECT_CALL(cb, Call("hello", "world"));
+  }
+  EXPECT_FALSE(headers->iterateForEncoding(key_value_cb));
+
+  // Iteration stops on Iterate::Break.
+  EXPECT_CALL(cb, Call(":path", "/new"));
+  EXPECT_FALSE(headers->iterateForEncoding(
+      [&cb](const HeaderString& key, const HeaderString& value) -> HeaderMap::Iterate {
+        cb.Call(std::string(key.getStringView()), std::string(value.getStringView()));
+        return HeaderMap::Iterate::Break;
+      }));
+}
+
+TEST(HeaderMapImplTest, DumpStateDoesNotMaterializeDeferredHeaders) {
+  auto headers = RequestHeaderMapImpl::create();
+  headers->addCopyDeferred("hello", "world");
+  headers->addCopyDeferred(":method", "GET");
+  std::stringstream out;
+  headers->dumpState(out);
+  EXPECT_EQ("':method', 'GET'\n'hello', 'world'\n", out.str());
+  EXPECT_EQ(2, headers->size());
+}
+
 TEST(HeaderMapImplTest, Get) {
   {
     auto headers = TestRequestHeaderMapImpl({{Headers::get().Path.get(), "/"}, {"hello", "world"}});
@@ -0,0 +1,94 @@
+#include <string>
+
+#include "source/common/http/header_utility.h"
+#include "source/common/http/http1/header_scanner.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Http {
+namespace Http1 {
+namespace {
+
+class HeaderScannerTest : public testing::TestWithParam<HeaderScanner::Implementation> {
+public:
+  HeaderScannerTest() { HeaderScanner::setImplementation(GetParam()); }
+  ~HeaderScannerTest() override { HeaderScanner::setImplementation(default_implementation_); }
+
+  const HeaderScanner::Implementation default_implementation_{HeaderScanner::implementation()};
+};
+
+INSTANTIATE_TEST_SUITE_P(Implementations, HeaderScannerTest,
+                         testing::Values(HeaderScanner::Implementation::Scalar,
+                                         HeaderScanner::Implementation::Sse2));
+
+// Check every byte value at every position of inputs spanning more than one vector, so that both
+// the vectorized loop and the scalar tail are exercised.
+TEST_P(HeaderScannerTest, FieldNameCharacters) {
+  for (size_t length : {1, 15, 16, 17, 40}) {
+    for (int c = 0; c < 256; ++c) {
+      for (size_t pos = 0; pos < length; ++pos) {
+        std::string name(length, 'a');
+        name[pos] = static_cast<char>(c);
+        EXPECT_EQ(HeaderUtility::headerNameIsValid(name) && c != ':',
+                  HeaderScanner::isValidFieldName(name))
+            << "c=" << c << " length=" << length << " pos=" << pos;
+      }
+    }
+  }
+  EXPECT_TRUE(HeaderScanner::isValidFieldName(""));
+  EXPECT_TRUE(HeaderScanner::isValidFieldName("x-forwarded-for"));
+  EXPECT_TRUE(HeaderScanner::isValidFieldName("X-Custom-Header!#$%&'*+-.^_`|~0123456789"));
+  EXPECT_FALSE(HeaderScanner::isValidFieldName("x-forwarded for"));
+  EXPECT_FALSE(HeaderScanner::isValidFieldName("a-very-long-header-name(comment)"));
+}
+
+TEST_P(HeaderScannerTest, FieldValueCharacters) {
+  for (size_t length : {1, 15, 16, 17, 40}) {
+    for (int c = 0; c < 256; ++c) {
+      for (size_t pos = 0; pos < length; ++pos) {
+        std::string value(length, 'a');
+        value[pos] = static_cast<char>(c);
+        EXPECT_EQ(HeaderUtility::headerValueIsValid(value), HeaderScanner::isValidFieldValue(value))
+            << "c=" << c << " length=" << length << " pos=" << pos;
+      }
+    }
+  }
+  EXPECT_TRUE(HeaderScanner::isValidFieldValue(""));
+  EXPECT_TRUE(HeaderScanner::isValidFieldValue("text/html,application/xhtml+xml;q=0.9\t\x80\xff"));
+  EXPECT_FALSE(HeaderScanner::isValidFieldValue("text/html,application/xhtml+xml;q=0.9\x7f"));
+  EXPECT_FALSE(HeaderScanner::isValidFieldValue(std::string("gzip, deflate\0br", 16)));
+}
+
+TEST_P(HeaderScannerTest, FindCrOrLf) {
+  EXPECT_EQ(absl::string_view::npos, HeaderScanner::findCrOrLf(""));
+  EXPECT_EQ(absl::string_view::npos, HeaderScanner::findCrOrLf("no line breaks in this value"));
+  for (size_t length : {1, 15, 16, 17, 40}) {
+    for (size_t pos = 0; pos < length; ++pos) {
+      for (const char c : {'\r', '\n'}) {
+        std::string data(length, 'a');
+        data[pos] = c;
+        EXPECT_EQ(pos, HeaderScanner::findCrOrLf(data)) << "length=" << length << " pos=" << pos;
+        // Only the first occurrence is reported.
+        data.append("\r\n");
+        EXPECT_EQ(pos, HeaderScanner::findCrOrLf(data)) << "length=" << length << " pos=" << pos;
+      }
+    }
+  }
+}
+
+TEST(HeaderScannerSelectionTest, SetImplementation) {
+  const HeaderScanner::Implementation original = HeaderScanner::implementation();
+  HeaderScanner::setImplementation(HeaderScanner::Implementation::Scalar);
+  EXPECT_EQ(HeaderScanner::Implementation::Scalar, HeaderScanner::implementation());
+  HeaderScanner::setImplementation(HeaderScanner::Implementation::Sse2);
+  EXPECT_EQ(HeaderScanner::sse2Available() ? HeaderScanner::Implementation::Sse2
+                                           : HeaderScanner::Implementation::Scalar,
+            HeaderScanner::implementation());
+  HeaderScanner::setImplementation(original);
+}
+
+} // namespace
+} // namespace Http1
+} // namespace Http
+} // namespace Envoy
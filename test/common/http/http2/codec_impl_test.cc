@@ -625,6 +625,105 @@ TEST_P(Http2CodecImplTest, SimpleRequestResponse) {
   }
 }
 
+TEST_P(Http2CodecImplTest, DeferredHeaderMaterialization) {
+  scoped_runtime_.mergeValues(
+      {{"envoy.reloadable_features.defer_decoded_header_materialization", "true"}});
+  initialize();
+
+  TestRequestHeaderMapImpl request_headers;
+  HttpTestUtility::addDefaultHeaders(request_headers);
+  request_headers.addCopy("x-custom", "foo");
+  request_headers.addCopy("user-agent", "envoy");
+  request_headers.addCopy("cookie", "a=b");
+  request_headers.addCopy("cookie", "c=d");
+  request_headers.addCopy("x-other", "bar");
+
+  // Decoded headers that are not O(1) headers follow the O(1) ones.
+  TestRequestHeaderMapImpl expected_headers;
+  HttpTestUtility::addDefaultHeaders(expected_headers);
+  expected_headers.addCopy("user-agent", "envoy");
+  expected_headers.addCopy("x-custom", "foo");
+  expected_headers.addCopy("x-other", "bar");
+  expected_headers.addCopy("cookie", "a=b; c=d");
+  EXPECT_CALL(request_decoder_, decodeHeaders_(HeaderMapEqualIgnoreOrder(&expected_headers), true))
+      .WillOnce(Invoke([](RequestHeaderMapSharedPtr& headers, bool) {
+        EXPECT_EQ("envoy", headers->getUserAgentValue());
+        EXPECT_EQ("foo", headers->get(LowerCaseString("x-custom"))[0]->value().getStringView());
+      }));
+  EXPECT_TRUE(request_encoder_->encodeHeaders(request_headers, true).ok());
+  driveToCompletion();
+}
+
+// Headers that were decoded with deferral and never inspected are encoded without materializing
+// them.
+TEST_P(Http2CodecImplTest, EncodeDeferredHeaders) {
+  initialize();
+
+  auto request_headers = RequestHeaderMapImpl::create();
+  HttpTestUtility::addDefaultHeaders(*request_headers);
+  request_headers->addCopyDeferred("x-custom", "foo");
+  request_headers->addCopyDeferred("x-other", "bar");
+
+  TestRequestHeaderMapImpl expected_headers;
+  HttpTestUtility::addDefaultHeaders(expected_headers);
+  expected_headers.addCopy("x-custom", "foo");
+  expected_headers.addCopy("x-other", "bar");
+  EXPECT_CALL(request_decoder_, decodeHeaders_(HeaderMapEqual(&expected_headers), true));
+  EXPECT_TRUE(request_encoder_->encodeHeaders(*request_headers, true).ok());
+  driveToCompletion();
+  EXPECT_EQ(1, client_stats_store_.counter("http2.deferred_headers_encoded").value());
+
+  // Once a non inline header has been read the headers are materialized.
+  EXPECT_EQ("foo", request_headers->get(LowerCaseString("x-custom"))[0]->value().getStringView());
+  TestResponseHeaderMapImpl response_headers{{":status", "200"}};
+  EXPECT_CALL(response_decoder_, decodeHeaders_(_, true));
+  response_encoder_->encodeHeaders(response_headers, true);
+  driveToCompletion();
+  EXPECT_EQ(0, server_stats_store_.counter("http2.deferred_headers_encoded").value());
+}
+
+// Headers encoded while the connection is dispatching are serialized after encodeHeaders()
+// returns, so deferred headers must not be referenced from the header map, which may be gone by
+// then.
+TEST_P(Http2CodecImplTest, EncodeDeferredHeadersWhileDispatching) {
+  initialize();
+
+  TestRequestHeaderMapImpl request_headers;
+  HttpTestUtility::addDefaultHeaders(request_headers);
+  EXPECT_CALL(request_decoder_, decodeHeaders_(_, true)).WillOnce(InvokeWithoutArgs([&]() -> void {
+    auto response_headers = ResponseHeaderMapImpl::create();
+    response_headers->setStatus(200);
+    response_headers->addCopyDeferred("x-custom", "foo");
+    response_encoder_->encodeHeaders(*response_headers, true);
+  }));
+  TestResponseHeaderMapImpl expected_headers{{":status", "200"}, {"x-custom", "foo"}};
+  EXPECT_CALL(response_decoder_, decodeHeaders_(HeaderMapEqual(&expected_headers), true));
+  EXPECT_TRUE(request_encoder_->encodeHeaders(request_headers, true).ok());
+  driveToCompletion();
+  EXPECT_EQ(1, server_stats_store_.counter("http2.deferred_headers_encoded").value());
+}
+
+// Deferred headers that were materialized by a lookup must not reference the map either. Under
+// ASAN this fails with a use-after-free if they are passed to the codec as reference strings.
+TEST_P(Http2CodecImplTest, EncodeMaterializedDeferredHeadersWhileDispatching) {
+  initialize();
+
+  TestRequestHeaderMapImpl request_headers;
+  HttpTestUtility::addDefaultHeaders(request_headers);
+  EXPECT_CALL(request_decoder_, decodeHeaders_(_, true)).WillOnce(InvokeWithoutArgs([&]() -> void {
+    auto response_headers = ResponseHeaderMapImpl::create();
+    response_headers->setStatus(200);
+    response_headers->addCopyDeferred("x-custom", "foo");
+    EXPECT_FALSE(response_headers->get(LowerCaseString("x-custom")).empty());
+    response_encoder_->encodeHeaders(*response_headers, true);
+  }));
+  TestResponseHeaderMapImpl expected_headers{{":status", "200"}, {"x-custom", "foo"}};
+  EXPECT_CALL(response_decoder_, decodeHeaders_(HeaderMapEqual(&expected_headers), true));
+  EXPECT_TRUE(request_encoder_->encodeHeaders(request_headers, true).ok());
+  driveToCompletion();
+  EXPECT_EQ(0, server_stats_store_.counter("http2.deferred_headers_encoded").value());
+}
+
 TEST_P(Http2CodecImplTest, ClientUnexpectedHeaders) {
   initialize();
 
@@ -33,8 +33,10 @@ public:
 
 class IoUringWorkerTestImpl : public IoUringWorkerImpl {
 public:
-  IoUringWorkerTestImpl(IoUringPtr io_uring_instance, Event::Dispatcher& dispatcher)
-      : IoUringWorkerImpl(std::move(io_uring_instance), 8192, 1000, dispatcher) {}
+  IoUringWorkerTestImpl(IoUringPtr io_uring_instance, Event::Dispatcher& dispatcher,
+                        bool enable_batch_submission = false)
+      : IoUringWorkerImpl(std::move(io_uring_instance), 8192, 1000, dispatcher,
+                          enable_batch_submission) {}
 
   IoUringSocket& addTestSocket(os_fd_t fd) {
     return addSocket(std::make_unique<IoUringSocketTestImpl>(fd, *this));
@@ -178,6 +180,59 @@ TEST(IoUringWorkerImplTest, DelaySubmit) {
   EXPECT_CALL(dispatcher, clearDeferredDeleteList());
 }
 
+TEST(IoUringWorkerImplTest, BatchSubmission) {
+  Event::MockDispatcher dispatcher;
+  IoUringPtr io_uring_instance = std::make_unique<MockIoUring>();
+  MockIoUring& mock_io_uring = *dynamic_cast<MockIoUring*>(io_uring_instance.get());
+
+  EXPECT_CALL(mock_io_uring, registerEventfd());
+  EXPECT_CALL(dispatcher, createFileEvent_(_, _, Event::PlatformDefaultTriggerType,
+                                           Event::FileReadyType::Read));
+  auto* submit_cb = new NiceMock<Event::MockSchedulableCallback>(&dispatcher);
+  IoUringWorkerTestImpl worker(std::move(io_uring_instance), dispatcher, true);
+
+  os_fd_t fd;
+  SET_SOCKET_INVALID(fd);
+  auto& io_uring_socket = worker.addTestSocket(fd);
+
+  // Requests are only prepared, and the submission is scheduled once for the current iteration.
+  EXPECT_CALL(mock_io_uring, submit()).Times(0);
+  EXPECT_CALL(*submit_cb, scheduleCallbackCurrentIteration());
+  EXPECT_CALL(mock_io_uring, prepareReadv(fd, _, _, _, _))
+      .WillOnce(Return<IoUringResult>(IoUringResult::Ok));
+  delete worker.submitReadRequest(io_uring_socket);
+  EXPECT_CALL(mock_io_uring, prepareShutdown(fd, _, _))
+      .WillOnce(Return<IoUringResult>(IoUringResult::Ok));
+  delete worker.submitShutdownRequest(io_uring_socket, SHUT_WR);
+  testing::Mock::VerifyAndClearExpectations(&mock_io_uring);
+
+  // All the prepared requests are submitted with a single call at the end of the iteration.
+  EXPECT_CALL(mock_io_uring, submit());
+  submit_cb->invokeCallback();
+  testing::Mock::VerifyAndClearExpectations(&mock_io_uring);
+
+  // A full submission queue is flushed immediately and the scheduled submission is cancelled.
+  EXPECT_CALL(*submit_cb, scheduleCallbackCurrentIteration());
+  EXPECT_CALL(mock_io_uring, prepareClose(fd, _))
+      .WillOnce(Return<IoUringResult>(IoUringResult::Ok))
+      .RetiresOnSaturation();
+  delete worker.submitCloseRequest(io_uring_socket);
+  EXPECT_CALL(*submit_cb, cancel());
+  EXPECT_CALL(mock_io_uring, submit());
+  EXPECT_CALL(mock_io_uring, prepareClose(fd, _))
+      .WillOnce(Return<IoUringResult>(IoUringResult::Failed))
+      .WillOnce(Return<IoUringResult>(IoUringResult::Ok));
+  EXPECT_CALL(*submit_cb, scheduleCallbackCurrentIteration());
+  delete worker.submitCloseRequest(io_uring_socket);
+  EXPECT_TRUE(submit_cb->enabled_);
+
+  EXPECT_CALL(mock_io_uring, removeInjectedCompletion(fd));
+  EXPECT_CALL(dispatcher, deferredDelete_);
+  dynamic_cast<IoUringSocketTestImpl*>(worker.getSockets().front().get())->cleanupForTest();
+  EXPECT_EQ(0, worker.getNumOfSockets());
+  EXPECT_CALL(dispatcher, clearDeferredDeleteList());
+}
+
 // This tests ensure the write request won't be override by an injected completion.
 TEST(IoUringWorkerImplTest, ServerSocketInjectAfterWrite) {
   Event::MockDispatcher dispatcher;
@@ -394,6 +449,61 @@ TEST(IoUringWorkerImplTest, CloseAllSocketsWhenDestruction) {
   worker.reset();
 }
 
+// With batch submission the close requests made while destroying the worker must be submitted by
+// the worker itself, as the dispatcher won't run the scheduled submission.
+TEST(IoUringWorkerImplTest, CloseAllSocketsWhenDestructionWithBatchSubmission) {
+  Event::MockDispatcher dispatcher;
+  IoUringPtr io_uring_instance = std::make_unique<MockIoUring>();
+  MockIoUring& mock_io_uring = *dynamic_cast<MockIoUring*>(io_uring_instance.get());
+
+  EXPECT_CALL(mock_io_uring, registerEventfd());
+  EXPECT_CALL(dispatcher,
+              createFileEvent_(_, _, Event::PlatformDefaultTriggerType, Event::FileReadyType::Read))
+      .WillOnce(ReturnNew<NiceMock<Event::MockFileEvent>>());
+  new NiceMock<Event::MockSchedulableCallback>(&dispatcher);
+  std::unique_ptr<IoUringWorkerTestImpl> worker = std::make_unique<IoUringWorkerTestImpl>(
+      std::move(io_uring_instance), dispatcher, /*enable_batch_submission=*/true);
+
+  os_fd_t fd = 11;
+  SET_SOCKET_INVALID(fd);
+
+  // Completions are only delivered for requests which have been submitted.
+  bool submitted = false;
+  EXPECT_CALL(mock_io_uring, submit()).WillRepeatedly(Invoke([&submitted]() {
+    submitted = true;
+    return IoUringResult::Ok;
+  }));
+
+  Request* read_req = nullptr;
+  EXPECT_CALL(mock_io_uring, prepareReadv(fd, _, _, _, _))
+      .WillOnce(DoAll(SaveArg<4>(&read_req), Return<IoUringResult>(IoUringResult::Ok)));
+  worker->addServerSocket(fd, [](uint32_t) { return absl::OkStatus(); }, false);
+
+  Request* cancel_req = nullptr;
+  EXPECT_CALL(mock_io_uring, prepareCancel(_, _))
+      .WillOnce(DoAll(SaveArg<1>(&cancel_req), Return<IoUringResult>(IoUringResult::Ok)));
+  Request* close_req = nullptr;
+  EXPECT_CALL(mock_io_uring, prepareClose(fd, _))
+      .WillOnce(DoAll(SaveArg<1>(&close_req), Return<IoUringResult>(IoUringResult::Ok)));
+  EXPECT_CALL(mock_io_uring, removeInjectedCompletion(fd));
+  EXPECT_CALL(mock_io_uring, forEveryCompletion(_))
+      .WillOnce(Invoke([&](const CompletionCb& cb) {
+        EXPECT_TRUE(submitted);
+        submitted = false;
+        // The cancel completes, which prepares the close request.
+        cb(read_req, -ECANCELED, false);
+        cb(cancel_req, 0, false);
+      }))
+      .WillOnce(Invoke([&](const CompletionCb& cb) {
+        EXPECT_TRUE(submitted);
+        cb(close_req, 0, false);
+      }));
+
+  EXPECT_CALL(dispatcher, deferredDelete_);
+  EXPECT_CALL(dispatcher, clearDeferredDeleteList());
+  worker.reset();
+}
+
 TEST(IoUringWorkerImplTest, ServerCloseWithWriteRequestOnly) {
   Event::MockDispatcher dispatcher;
   IoUringPtr io_uring_instance = std::make_unique<MockIoUring>();
@@ -3,8 +3,11 @@
 #include "source/common/network/io_socket_error_impl.h"
 #include "source/common/network/io_socket_handle_impl.h"
 #include "source/common/network/listen_socket_impl.h"
+#include "source/common/stats/isolated_store_impl.h"
 
 #include "test/mocks/api/mocks.h"
+#include "test/mocks/event/mocks.h"
+#include "test/mocks/thread_local/mocks.h"
 #include "test/test_common/environment.h"
 #include "test/test_common/network_utility.h"
 #include "test/test_common/threadsafe_singleton_injector.h"
@@ -13,11 +16,18 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#if defined(__linux__)
+#include <linux/errqueue.h>
+#endif
+
 using testing::_;
+using testing::DoAll;
 using testing::Eq;
 using testing::Invoke;
 using testing::NiceMock;
 using testing::Return;
+using testing::ReturnNew;
+using testing::SaveArg;
 
 namespace Envoy {
 namespace Network {
@@ -303,6 +313,10 @@ TEST_P(IoSocketHandleImplTest, InterfaceNameForLoopback) {
 // protected methods.
 class IoSocketHandleImplTestWrapper {
 public:
+  static size_t pendingZeroCopySends(const IoSocketHandleImpl& io_handle) {
+    return io_handle.zero_copy_sends_.size();
+  }
+
   void runGetAddressTests(const int cache_size) {
     IoSocketHandleImpl io_handle(-1, false, absl::nullopt, cache_size);
 
@@ -382,5 +396,203 @@ TEST(IoSocketHandleImpl, GetOrCreateEnvoyAddressInstance) {
   wrapper.runGetAddressTests(/*cache_size=*/10);
 }
 
+#if defined(__linux__) && defined(MSG_ZEROCOPY) && defined(SO_EE_ORIGIN_ZEROCOPY)
+namespace {
+
+// Completes the zero-copy send with the given id.
+Api::SysCallSizeResult zeroCopyCompletion(msghdr* message, uint32_t id, bool copied = false) {
+  cmsghdr* cmsg = CMSG_FIRSTHDR(message);
+  cmsg->cmsg_level = SOL_IP;
+  cmsg->cmsg_type = IP_RECVERR;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(sock_extended_err));
+  sock_extended_err error{};
+  error.ee_origin = SO_EE_ORIGIN_ZEROCOPY;
+  error.ee_code = copied ? SO_EE_CODE_ZEROCOPY_COPIED : 0;
+  error.ee_info = id;
+  error.ee_data = id;
+  memcpy(CMSG_DATA(cmsg), &error, sizeof(error));
+  message->msg_controllen = CMSG_SPACE(sizeof(sock_extended_err));
+  return Api::SysCallSizeResult{0, 0};
+}
+
+class ZeroCopySendTest : public testing::Test {
+protected:
+  ZeroCopySendTest()
+      : os_calls_(&os_sys_calls_),
+        config_(std::make_shared<ZeroCopySendConfig>(1024, std::chrono::milliseconds(1000),
+                                                     *store_.rootScope(), tls_)) {
+    config_->onWorkerThreadInitialized();
+  }
+
+  // Writes a zero-copy send of 4096 bytes to `io_handle`, whose slices set `released` once they
+  // are released.
+  void zeroCopyWrite(IoSocketHandleImpl& io_handle, bool& released) {
+    Buffer::OwnedImpl buffer;
+    buffer.addBufferFragment(*fragments_.emplace_back(std::make_unique<Buffer::BufferFragmentImpl>(
+        data_.data(), data_.size(),
+        [&released](const void*, size_t, const Buffer::BufferFragmentImpl*) { released = true; })));
+    EXPECT_CALL(os_sys_calls_, sendmsg(io_handle.fdDoNotUse(), _, MSG_ZEROCOPY))
+        .WillOnce(Return(Api::SysCallSizeResult{4096, 0}));
+    EXPECT_EQ(4096, io_handle.write(buffer).return_value_);
+  }
+
+  NiceMock<Api::MockOsSysCalls> os_sys_calls_;
+  TestThreadsafeSingletonInjector<Api::OsSysCallsImpl> os_calls_;
+  Stats::IsolatedStoreImpl store_;
+  NiceMock<ThreadLocal::MockInstance> tls_;
+  ZeroCopySendConfigSharedPtr config_;
+  const std::string data_ = std::string(4096, 'a');
+  std::vector<std::unique_ptr<Buffer::BufferFragmentImpl>> fragments_;
+};
+
+} // namespace
+
+TEST_F(ZeroCopySendTest, Send) {
+  IoSocketHandleImpl io_handle(10);
+  EXPECT_CALL(os_sys_calls_, setsockopt_(10, SOL_SOCKET, SO_ZEROCOPY, _, _)).WillOnce(Return(0));
+  ASSERT_TRUE(io_handle.enableZeroCopySend(config_));
+
+  // Small writes are copied.
+  Buffer::OwnedImpl small_buffer("hello");
+  EXPECT_CALL(os_sys_calls_, send(10, _, 5, 0)).WillOnce(Return(Api::SysCallSizeResult{5, 0}));
+  EXPECT_EQ(5, io_handle.write(small_buffer).return_value_);
+
+  // Large writes are sent with MSG_ZEROCOPY, and their slices are kept until the send completes.
+  Buffer::OwnedImpl large_buffer(std::string(4096, 'a'));
+  EXPECT_CALL(os_sys_calls_, sendmsg(10, _, MSG_ZEROCOPY))
+      .WillOnce(Return(Api::SysCallSizeResult{4096, 0}));
+  EXPECT_EQ(4096, io_handle.write(large_buffer).return_value_);
+  EXPECT_EQ(0, large_buffer.length());
+  EXPECT_EQ(1, IoSocketHandleImplTestWrapper::pendingZeroCopySends(io_handle));
+  EXPECT_EQ(1, TestUtility::findCounter(store_, "zero_copy_send.sent")->value());
+
+  // The kernel refuses to pin more pages, so the write is copied.
+  Buffer::OwnedImpl refused_buffer(std::string(4096, 'b'));
+  EXPECT_CALL(os_sys_calls_, recvmsg(10, _, MSG_ERRQUEUE))
+      .WillOnce(Return(Api::SysCallSizeResult{-1, SOCKET_ERROR_AGAIN}));
+  EXPECT_CALL(os_sys_calls_, sendmsg(10, _, MSG_ZEROCOPY))
+      .WillOnce(Return(Api::SysCallSizeResult{-1, ENOBUFS}));
+  EXPECT_CALL(os_sys_calls_, send(10, _, 4096, 0))
+      .WillOnce(Return(Api::SysCallSizeResult{4096, 0}));
+  EXPECT_EQ(4096, io_handle.write(refused_buffer).return_value_);
+  EXPECT_EQ(1, IoSocketHandleImplTestWrapper::pendingZeroCopySends(io_handle));
+  EXPECT_EQ(1, TestUtility::findCounter(store_, "zero_copy_send.fallback")->value());
+
+  // The completion notification releases the slices of the first zero-copy send.
+  EXPECT_CALL(os_sys_calls_, recvmsg(10, _, MSG_ERRQUEUE))
+      .WillOnce(Invoke(
+          [](os_fd_t, msghdr* message, int) { return zeroCopyCompletion(message, 0, true); }));
+  small_buffer.add("hello");
+  EXPECT_CALL(os_sys_calls_, send(10, _, 5, 0)).WillOnce(Return(Api::SysCallSizeResult{5, 0}));
+  EXPECT_EQ(5, io_handle.write(small_buffer).return_value_);
+  EXPECT_EQ(0, IoSocketHandleImplTestWrapper::pendingZeroCopySends(io_handle));
+  EXPECT_EQ(1, TestUtility::findCounter(store_, "zero_copy_send.copied")->value());
+}
+
+TEST_F(ZeroCopySendTest, OutstandingOnClose) {
+  auto io_handle = std::make_unique<IoSocketHandleImpl>(10);
+  EXPECT_CALL(os_sys_calls_, setsockopt_(10, SOL_SOCKET, SO_ZEROCOPY, _, _)).WillOnce(Return(0));
+  ASSERT_TRUE(io_handle->enableZeroCopySend(config_));
+  bool released = false;
+  zeroCopyWrite(*io_handle, released);
+
+  // The send hasn't completed when the handle is closed. The FIN is sent, but the socket stays
+  // open and the slices stay alive, as the kernel may still retransmit from them.
+  Event::FileReadyCb file_ready_cb;
+  EXPECT_CALL(tls_.dispatcher_, createFileEvent_(10, _, Event::PlatformDefaultTriggerType,
+                                                 Event::FileReadyType::Read))
+      .WillOnce(DoAll(SaveArg<1>(&file_ready_cb), ReturnNew<NiceMock<Event::MockFileEvent>>()));
+  auto* close_timer = new NiceMock<Event::MockTimer>(&tls_.dispatcher_);
+  EXPECT_CALL(*close_timer, enableTimer(std::chrono::milliseconds(1000), _));
+  EXPECT_CALL(os_sys_calls_, recvmsg(10, _, MSG_ERRQUEUE))
+      .WillOnce(Return(Api::SysCallSizeResult{-1, SOCKET_ERROR_AGAIN}));
+  EXPECT_CALL(os_sys_calls_, shutdown(10, ENVOY_SHUT_WR))
+      .WillOnce(Return(Api::SysCallIntResult{0, 0}));
+  EXPECT_CALL(os_sys_calls_, close(10)).Times(0);
+  EXPECT_TRUE(io_handle->close().ok());
+  io_handle.reset();
+  EXPECT_FALSE(released);
+  EXPECT_EQ(1, config_->closedSockets()->size());
+
+  // The completion wakes up the socket's file event, with no other socket activity on the thread.
+  // Reaping it releases the slices and closes the socket.
+  EXPECT_CALL(os_sys_calls_, recvmsg(10, _, MSG_ERRQUEUE))
+      .WillOnce(
+          Invoke([](os_fd_t, msghdr* message, int) { return zeroCopyCompletion(message, 0); }));
+  EXPECT_CALL(os_sys_calls_, setsockopt_(10, SOL_SOCKET, SO_LINGER, _, _)).Times(0);
+  EXPECT_CALL(os_sys_calls_, close(10)).WillOnce(Return(Api::SysCallIntResult{0, 0}));
+  EXPECT_TRUE(file_ready_cb(Event::FileReadyType::Read).ok());
+  EXPECT_TRUE(released);
+  EXPECT_EQ(0, config_->closedSockets()->size());
+  EXPECT_EQ(0, TestUtility::findCounter(store_, "zero_copy_send.close_timeout")->value());
+}
+
+// The peer never acknowledges the data of a closed socket, so its completions never arrive.
+TEST_F(ZeroCopySendTest, OutstandingOnCloseTimeout) {
+  auto io_handle = std::make_unique<IoSocketHandleImpl>(10);
+  EXPECT_CALL(os_sys_calls_, setsockopt_(10, SOL_SOCKET, SO_ZEROCOPY, _, _)).WillOnce(Return(0));
+  ASSERT_TRUE(io_handle->enableZeroCopySend(config_));
+  bool released = false;
+  zeroCopyWrite(*io_handle, released);
+
+  auto* close_timer = new NiceMock<Event::MockTimer>(&tls_.dispatcher_);
+  EXPECT_CALL(*close_timer, enableTimer(std::chrono::milliseconds(1000), _));
+  EXPECT_CALL(os_sys_calls_, recvmsg(10, _, MSG_ERRQUEUE))
+      .WillRepeatedly(Return(Api::SysCallSizeResult{-1, SOCKET_ERROR_AGAIN}));
+  EXPECT_CALL(os_sys_calls_, close(10)).Times(0);
+  EXPECT_TRUE(io_handle->close().ok());
+  io_handle.reset();
+  EXPECT_FALSE(released);
+
+  // Once the close times out, the connection is reset, which discards the unacknowledged data and
+  // with it the kernel's references to the slices.
+  EXPECT_CALL(os_sys_calls_, setsockopt_(10, SOL_SOCKET, SO_LINGER, _, _)).WillOnce(Return(0));
+  EXPECT_CALL(os_sys_calls_, close(10)).WillOnce(Return(Api::SysCallIntResult{0, 0}));
+  close_timer->invokeCallback();
+  EXPECT_TRUE(released);
+  EXPECT_EQ(0, config_->closedSockets()->size());
+  EXPECT_EQ(1, TestUtility::findCounter(store_, "zero_copy_send.close_timeout")->value());
+}
+
+// Without a dispatcher to wait for the completions on, the connection is reset on close.
+TEST_F(ZeroCopySendTest, OutstandingOnCloseWithoutDispatcher) {
+  tls_.registered_ = false;
+  IoSocketHandleImpl io_handle(10);
+  EXPECT_CALL(os_sys_calls_, setsockopt_(10, SOL_SOCKET, SO_ZEROCOPY, _, _)).WillOnce(Return(0));
+  ASSERT_TRUE(io_handle.enableZeroCopySend(config_));
+  bool released = false;
+  zeroCopyWrite(io_handle, released);
+
+  EXPECT_CALL(os_sys_calls_, recvmsg(10, _, MSG_ERRQUEUE))
+      .WillOnce(Return(Api::SysCallSizeResult{-1, SOCKET_ERROR_AGAIN}));
+  EXPECT_CALL(os_sys_calls_, shutdown(_, _)).Times(0);
+  EXPECT_CALL(os_sys_calls_, setsockopt_(10, SOL_SOCKET, SO_LINGER, _, _)).WillOnce(Return(0));
+  EXPECT_CALL(os_sys_calls_, close(10)).WillOnce(Return(Api::SysCallIntResult{0, 0}));
+  EXPECT_TRUE(io_handle.close().ok());
+  EXPECT_TRUE(released);
+}
+
+TEST_F(ZeroCopySendTest, OutstandingOnResetClose) {
+  IoSocketHandleImpl io_handle(10);
+  EXPECT_CALL(os_sys_calls_, setsockopt_(10, SOL_SOCKET, SO_ZEROCOPY, _, _)).WillOnce(Return(0));
+  ASSERT_TRUE(io_handle.enableZeroCopySend(config_));
+  const struct linger linger_option = {1, 0};
+  EXPECT_TRUE(
+      io_handle.setOption(SOL_SOCKET, SO_LINGER, &linger_option, sizeof(linger_option)).ok());
+  bool released = false;
+  zeroCopyWrite(io_handle, released);
+
+  // The reset discards the unacknowledged data, so the socket is closed right away.
+  EXPECT_CALL(os_sys_calls_, recvmsg(10, _, MSG_ERRQUEUE))
+      .WillOnce(Return(Api::SysCallSizeResult{-1, SOCKET_ERROR_AGAIN}));
+  EXPECT_CALL(os_sys_calls_, shutdown(_, _)).Times(0);
+  EXPECT_CALL(os_sys_calls_, close(10)).WillOnce(Return(Api::SysCallIntResult{0, 0}));
+  EXPECT_TRUE(io_handle.close().ok());
+  EXPECT_TRUE(released);
+  EXPECT_EQ(0, IoSocketHandleImplTestWrapper::pendingZeroCopySends(io_handle));
+  EXPECT_EQ(0, config_->closedSockets()->size());
+}
+#endif
+
 } // namespace Network
 } // namespace Envoy
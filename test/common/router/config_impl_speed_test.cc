@@ -39,12 +39,14 @@ static Http::TestRequestHeaderMapImpl genRequestHeaders(int route_num) {
  * Generates the route config for the type of matcher being tested.
  */
 static RouteConfiguration genRouteConfig(benchmark::State& state,
-                                         RouteMatch::PathSpecifierCase match_type) {
+                                         RouteMatch::PathSpecifierCase match_type,
+                                         bool index_path_routes = false) {
   // Create the base route config.
   RouteConfiguration route_config;
   VirtualHost* v_host = route_config.add_virtual_hosts();
   v_host->set_name("default");
   v_host->add_domains("*");
+  v_host->set_index_path_routes(index_path_routes);
 
   // Create `n` regex routes. The last route will be the only one matched.
   for (int i = 0; i < state.range(0); ++i) {
@@ -204,7 +206,8 @@ static RouteConfiguration genPrefixMatcherTreeRouteConfig(benchmark::State& stat
  * We then time how long it takes for the request to be matched against the
  * last route.
  */
-static void bmRouteTableSize(benchmark::State& state, RouteMatch::PathSpecifierCase match_type) {
+static void bmRouteTableSize(benchmark::State& state, RouteMatch::PathSpecifierCase match_type,
+                             bool index_path_routes = false) {
   // Setup router for benchmarking.
   Api::ApiPtr api = Api::createApiForTest();
   NiceMock<Server::Configuration::MockServerFactoryContext> factory_context;
@@ -213,7 +216,7 @@ static void bmRouteTableSize(benchmark::State& state, RouteMatch::PathSpecifierC
 
   // Create router config.
   std::shared_ptr<ConfigImpl> config =
-      *ConfigImpl::create(genRouteConfig(state, match_type), factory_context,
+      *ConfigImpl::create(genRouteConfig(state, match_type, index_path_routes), factory_context,
                           ProtobufMessage::getNullValidationVisitor(), true);
 
   for (auto _ : state) { // NOLINT
@@ -244,6 +247,20 @@ static void bmRouteTableSizeWithExactPathMatch(benchmark::State& state) {
   bmRouteTableSize(state, RouteMatch::PathSpecifierCase::kPath);
 }
 
+/**
+ * Same as bmRouteTableSizeWithPathPrefixMatch, with the virtual host's path route index enabled.
+ */
+static void bmRouteTableSizeWithIndexedPathPrefixMatch(benchmark::State& state) {
+  bmRouteTableSize(state, RouteMatch::PathSpecifierCase::kPrefix, true);
+}
+
+/**
+ * Same as bmRouteTableSizeWithExactPathMatch, with the virtual host's path route index enabled.
+ */
+static void bmRouteTableSizeWithIndexedExactPathMatch(benchmark::State& state) {
+  bmRouteTableSize(state, RouteMatch::PathSpecifierCase::kPath, true);
+}
+
 /**
  * Benchmark a route table with regex path matchers in the form of:
  * - /shelves/{shelf_id}/route_1
@@ -311,13 +328,92 @@ static void bmRouteTableSizeWithPrefixMatcherTree(benchmark::State& state) {
   }
 }
 
+/**
+ * Generates a route config with n virtual hosts in a multi-tenant layout, cycling through:
+ * - tenant_x.example.com
+ * - *.tenant_x.example.com
+ * - *-tenant_x.example.net
+ * - tenant_x.internal.*
+ */
+static RouteConfiguration genVirtualHostsRouteConfig(benchmark::State& state) {
+  RouteConfiguration route_config;
+  for (int i = 0; i < state.range(0); ++i) {
+    VirtualHost* v_host = route_config.add_virtual_hosts();
+    v_host->set_name(absl::StrCat("vhost_", i));
+    const int tenant = i / 4;
+    switch (i % 4) {
+    case 0:
+      v_host->add_domains(absl::StrCat("tenant_", tenant, ".example.com"));
+      break;
+    case 1:
+      v_host->add_domains(absl::StrCat("*.tenant_", tenant, ".example.com"));
+      break;
+    case 2:
+      v_host->add_domains(absl::StrCat("*-tenant_", tenant, ".example.net"));
+      break;
+    default:
+      v_host->add_domains(absl::StrCat("tenant_", tenant, ".internal.*"));
+      break;
+    }
+    Route* route = v_host->add_routes();
+    route->mutable_match()->set_prefix("/");
+    route->mutable_direct_response()->set_status(200);
+  }
+  VirtualHost* v_host = route_config.add_virtual_hosts();
+  v_host->set_name("default");
+  v_host->add_domains("*");
+  Route* route = v_host->add_routes();
+  route->mutable_match()->set_prefix("/");
+  route->mutable_direct_response()->set_status(200);
+  return route_config;
+}
+
+/**
+ * Measure the speed of selecting a virtual host among n virtual hosts, for hosts resolved by
+ * exact, suffix wildcard, prefix wildcard and default domains.
+ */
+static void bmVirtualHostLookup(benchmark::State& state) {
+  Api::ApiPtr api = Api::createApiForTest();
+  NiceMock<Server::Configuration::MockServerFactoryContext> factory_context;
+  NiceMock<Envoy::StreamInfo::MockStreamInfo> stream_info;
+  ON_CALL(factory_context, api()).WillByDefault(ReturnRef(*api));
+
+  std::shared_ptr<ConfigImpl> config =
+      *ConfigImpl::create(genVirtualHostsRouteConfig(state), factory_context,
+                          ProtobufMessage::getNullValidationVisitor(), true);
+
+  const int last_tenant = (state.range(0) - 1) / 4;
+  std::vector<Http::TestRequestHeaderMapImpl> requests;
+  for (const std::string& host :
+       {absl::StrCat("tenant_", last_tenant, ".example.com"),
+        absl::StrCat("www.tenant_", last_tenant, ".example.com"),
+        absl::StrCat("eu-west-tenant_", last_tenant, ".example.net"),
+        absl::StrCat("tenant_", last_tenant, ".internal.corp"), std::string("unknown.org")}) {
+    requests.push_back(Http::TestRequestHeaderMapImpl{
+        {":authority", host}, {":method", "GET"}, {":path", "/"}, {"x-forwarded-proto", "http"}});
+  }
+
+  size_t i = 0;
+  for (auto _ : state) { // NOLINT
+    RELEASE_ASSERT(config->route(requests[i++ % requests.size()], stream_info, 0) != nullptr, "");
+  }
+}
+
 BENCHMARK(bmRouteTableSizeWithPathPrefixMatch)->RangeMultiplier(2)->Ranges({{1, 2 << 13}});
 BENCHMARK(bmRouteTableSizeWithExactPathMatch)->RangeMultiplier(2)->Ranges({{1, 2 << 13}});
 BENCHMARK(bmRouteTableSizeWithRegexMatch)->RangeMultiplier(2)->Ranges({{1, 2 << 13}});
+BENCHMARK(bmRouteTableSizeWithIndexedPathPrefixMatch)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 2 << 13}});
+BENCHMARK(bmRouteTableSizeWithIndexedExactPathMatch)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, 2 << 13}});
 
 BENCHMARK(bmRouteTableSizeWithExactMatcherTree)->RangeMultiplier(2)->Ranges({{1, 2 << 13}});
 BENCHMARK(bmRouteTableSizeWithPrefixMatcherTree)->RangeMultiplier(2)->Ranges({{1, 2 << 13}});
 
+BENCHMARK(bmVirtualHostLookup)->Arg(100)->Arg(10000)->Arg(100000)->Unit(benchmark::kNanosecond);
+
 } // namespace
 } // namespace Router
 } // namespace Envoy
@@ -1270,6 +1270,147 @@ virtual_hosts:
             config.route(genHeaders("example.com", "/", "GET"), 0)->routeEntry()->clusterName());
 }
 
+// Exact domains win over suffix wildcards, which win over prefix wildcards, and the longest
+// wildcard of each kind wins. A wildcard must match at least one character.
+TEST_F(RouteMatcherTest, TestWildcardDomainPrecedence) {
+  const std::string yaml = R"EOF(
+virtual_hosts:
+  - name: exact
+    domains: ["api.example.com"]
+    routes:
+      - match: { prefix: "/" }
+        route: { cluster: "exact" }
+  - name: short_suffix
+    domains: ["*.com"]
+    routes:
+      - match: { prefix: "/" }
+        route: { cluster: "short_suffix" }
+  - name: long_suffix
+    domains: ["*.example.com"]
+    routes:
+      - match: { prefix: "/" }
+        route: { cluster: "long_suffix" }
+  - name: short_prefix
+    domains: ["api.*"]
+    routes:
+      - match: { prefix: "/" }
+        route: { cluster: "short_prefix" }
+  - name: long_prefix
+    domains: ["api.example.*"]
+    routes:
+      - match: { prefix: "/" }
+        route: { cluster: "long_prefix" }
+  - name: default
+    domains: ["*"]
+    routes:
+      - match: { prefix: "/" }
+        route: { cluster: "default" }
+  )EOF";
+
+  factory_context_.cluster_manager_.initializeClusters(
+      {"exact", "short_suffix", "long_suffix", "short_prefix", "long_prefix", "default"}, {});
+  const auto proto_config = parseRouteConfigurationFromYaml(yaml);
+  TestConfigImpl config(proto_config, factory_context_, true, creation_status_);
+
+  const auto cluster_for_host = [&config](const std::string& host) {
+    return config.route(genHeaders(host, "/", "GET"), 0)->routeEntry()->clusterName();
+  };
+  EXPECT_EQ("exact", cluster_for_host("api.example.com"));
+  EXPECT_EQ("long_suffix", cluster_for_host("www.example.com"));
+  EXPECT_EQ("long_suffix", cluster_for_host("a.example.com"));
+  EXPECT_EQ("short_suffix", cluster_for_host(".example.com"));
+  EXPECT_EQ("short_suffix", cluster_for_host("example.com"));
+  EXPECT_EQ("short_suffix", cluster_for_host("api.example.org.com"));
+  EXPECT_EQ("default", cluster_for_host(".com"));
+  EXPECT_EQ("long_prefix", cluster_for_host("api.example.org"));
+  EXPECT_EQ("short_prefix", cluster_for_host("api.example."));
+  EXPECT_EQ("short_prefix", cluster_for_host("api.test"));
+  EXPECT_EQ("default", cluster_for_host("api."));
+  EXPECT_EQ("default", cluster_for_host("a"));
+  EXPECT_EQ("default", cluster_for_host("example.org"));
+}
+
+// Indexing path routes must select the same route as a linear scan, including when indexed runs
+// are interleaved with routes that cannot be indexed and when routes have further constraints.
+TEST_F(RouteMatcherTest, TestIndexedPathRoutesPreserveFirstMatch) {
+  const std::string yaml = R"EOF(
+virtual_hosts:
+  - name: local_service
+    domains: ["*"]
+    routes:
+      - match: { path: "/api/v1/users" }
+        route: { cluster: "users_exact" }
+      - match:
+          prefix: "/api/v1/users/"
+          headers:
+            - name: x-canary
+              string_match: { exact: "true" }
+        route: { cluster: "users_canary" }
+      - match: { prefix: "/api/v1/users/" }
+        route: { cluster: "users" }
+      - match: { prefix: "/api/v1/" }
+        route: { cluster: "api_v1" }
+      - match: { prefix: "/api/v1/users/admin" }
+        route: { cluster: "shadowed" }
+      - match: { safe_regex: { regex: "/api/v2/[a-z]+/health" } }
+        route: { cluster: "v2_health" }
+      - match: { prefix: "/API/V2/", case_sensitive: false }
+        route: { cluster: "v2_case_insensitive" }
+      - match: { path: "/static/logo.png" }
+        route: { cluster: "logo" }
+      - match: { prefix: "/static/" }
+        route: { cluster: "static" }
+      - match: { prefix: "/static" }
+        route: { cluster: "static_no_slash" }
+      - match: { path: "/static" }
+        route: { cluster: "shadowed" }
+      - match: { prefix: "/" }
+        route: { cluster: "default" }
+  )EOF";
+
+  factory_context_.cluster_manager_.initializeClusters(
+      {"users_exact", "users_canary", "users", "api_v1", "shadowed", "v2_health",
+       "v2_case_insensitive", "logo", "static", "static_no_slash", "default"},
+      {});
+  const auto linear_config = parseRouteConfigurationFromYaml(yaml);
+  auto indexed_config = linear_config;
+  indexed_config.mutable_virtual_hosts(0)->set_index_path_routes(true);
+  TestConfigImpl linear(linear_config, factory_context_, true, creation_status_);
+  ASSERT_TRUE(creation_status_.ok());
+  TestConfigImpl indexed(indexed_config, factory_context_, true, creation_status_);
+  ASSERT_TRUE(creation_status_.ok());
+
+  const std::vector<std::pair<std::string, std::string>> cases = {
+      {"/api/v1/users", "users_exact"},
+      {"/api/v1/users?limit=10", "users_exact"},
+      {"/api/v1/users/", "users"},
+      {"/api/v1/users/42", "users"},
+      {"/api/v1/users/admin", "users"},
+      {"/api/v1/groups", "api_v1"},
+      {"/api/v2/foo/health", "v2_health"},
+      {"/api/v2/other", "v2_case_insensitive"},
+      {"/static/logo.png", "logo"},
+      {"/static/logo.png#top", "logo"},
+      {"/static/app.js", "static"},
+      {"/static", "static_no_slash"},
+      {"/staticfiles", "static_no_slash"},
+      {"/", "default"},
+      {"/unknown", "default"},
+  };
+  for (const auto& [path, cluster] : cases) {
+    EXPECT_EQ(cluster, linear.route(genHeaders("host", path, "GET"), 0)->routeEntry()->clusterName())
+        << path;
+    EXPECT_EQ(cluster,
+              indexed.route(genHeaders("host", path, "GET"), 0)->routeEntry()->clusterName())
+        << path;
+  }
+
+  Http::TestRequestHeaderMapImpl canary_headers = genHeaders("host", "/api/v1/users/42", "GET");
+  canary_headers.addCopy("x-canary", "true");
+  EXPECT_EQ("users_canary", linear.route(canary_headers, 0)->routeEntry()->clusterName());
+  EXPECT_EQ("users_canary", indexed.route(canary_headers, 0)->routeEntry()->clusterName());
+}
+
 TEST_F(RouteMatcherTest, TestRoutesWithInvalidRegex) {
   std::string invalid_route = R"EOF(
 virtual_hosts:
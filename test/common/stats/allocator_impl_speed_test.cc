@@ -0,0 +1,137 @@
+// Note: this should be run with --compilation_mode=opt.
+//
+// bmCounterMemory and bmGaugeMemory report the heap bytes consumed per counter
+// or gauge, excluding the symbol table storage of its name, in the
+// "bytes_per_stat" counter. Memory is only measurable in tcmalloc builds; in
+// other builds bytes_per_stat is reported as zero.
+//
+// bmCounterContention measures increments of a single counter from many
+// threads, with and without sharding; it is most meaningful on a machine with
+// at least as many cores as the largest thread count.
+//
+// Running bazel-bin/test/common/stats/allocator_impl_benchmark --benchmark_counters_tabular=true
+
+#include <memory>
+#include <vector>
+
+#include "source/common/memory/stats.h"
+#include "source/common/stats/allocator_impl.h"
+#include "source/common/stats/symbol_table.h"
+
+#include "test/benchmark/main.h"
+
+#include "absl/strings/str_cat.h"
+#include "benchmark/benchmark.h"
+
+namespace Envoy {
+namespace Stats {
+
+class AllocatorMemoryTest {
+public:
+  explicit AllocatorMemoryTest(uint64_t num_stats) : pool_(symbol_table_) {
+    // Encode the names up front so their storage is not attributed to the stats.
+    names_.reserve(num_stats);
+    for (uint64_t i = 0; i < num_stats; ++i) {
+      names_.push_back(pool_.add(absl::StrCat("cluster.c", i / 100, ".upstream_rq_", i % 100)));
+    }
+  }
+
+  template <class StatSharedPtr, class MakeFn>
+  void test(::benchmark::State& state, MakeFn make_stat) {
+    uint64_t consumed_bytes = 0;
+    for (auto _ : state) {
+      UNREFERENCED_PARAMETER(_);
+      std::vector<StatSharedPtr> stats;
+      stats.reserve(names_.size());
+      const uint64_t start_bytes = Memory::Stats::totalCurrentlyAllocated();
+      {
+        AllocatorImpl alloc(symbol_table_);
+        for (StatName name : names_) {
+          stats.push_back(make_stat(alloc, name));
+        }
+        consumed_bytes = Memory::Stats::totalCurrentlyAllocated() - start_bytes;
+        stats.clear();
+      }
+    }
+    state.counters["bytes_per_stat"] = static_cast<double>(consumed_bytes) / names_.size();
+  }
+
+private:
+  SymbolTableImpl symbol_table_;
+  StatNamePool pool_;
+  std::vector<StatName> names_;
+};
+
+// Args: {number of stats}.
+static void bmCounterMemory(::benchmark::State& state) {
+  if (benchmark::skipExpensiveBenchmarks() && state.range(0) > 10000) {
+    state.SkipWithError("Skipping expensive benchmark");
+    return;
+  }
+
+  AllocatorMemoryTest memory_test(state.range(0));
+  memory_test.test<CounterSharedPtr>(state, [](Allocator& alloc, StatName name) {
+    return alloc.makeCounter(name, StatName(), {});
+  });
+}
+BENCHMARK(bmCounterMemory)
+    ->Unit(::benchmark::kMillisecond)
+    ->RangeMultiplier(10)
+    ->Range(1000, 1000000);
+
+// Args: {number of stats}.
+static void bmGaugeMemory(::benchmark::State& state) {
+  if (benchmark::skipExpensiveBenchmarks() && state.range(0) > 10000) {
+    state.SkipWithError("Skipping expensive benchmark");
+    return;
+  }
+
+  AllocatorMemoryTest memory_test(state.range(0));
+  memory_test.test<GaugeSharedPtr>(state, [](Allocator& alloc, StatName name) {
+    return alloc.makeGauge(name, StatName(), {}, Gauge::ImportMode::Accumulate);
+  });
+}
+BENCHMARK(bmGaugeMemory)
+    ->Unit(::benchmark::kMillisecond)
+    ->RangeMultiplier(10)
+    ->Range(1000, 1000000);
+
+// State shared by all threads of bmCounterContention. Google benchmark
+// synchronizes its threads on entry to and exit from the timing loop, so the
+// first thread creates it before the loop and destroys it after.
+struct CounterContentionState {
+  explicit CounterContentionState(bool sharded) : pool_(symbol_table_), alloc_(symbol_table_) {
+    StatName tag_extracted_name = pool_.add("http.downstream_rq_total");
+    if (sharded) {
+      alloc_.setShardedCounters({"http.downstream_rq_total"});
+    }
+    counter_ =
+        alloc_.makeCounter(pool_.add("http.ingress.downstream_rq_total"), tag_extracted_name, {});
+  }
+
+  SymbolTableImpl symbol_table_;
+  StatNamePool pool_;
+  AllocatorImpl alloc_;
+  CounterSharedPtr counter_;
+};
+
+// Args: {sharded}.
+static void bmCounterContention(::benchmark::State& state) {
+  static std::unique_ptr<CounterContentionState> contention;
+  if (state.thread_index() == 0) {
+    contention = std::make_unique<CounterContentionState>(state.range(0) == 1);
+  }
+
+  for (auto _ : state) {
+    UNREFERENCED_PARAMETER(_);
+    contention->counter_->inc();
+  }
+
+  if (state.thread_index() == 0) {
+    contention.reset();
+  }
+}
+BENCHMARK(bmCounterContention)->Arg(0)->Arg(1)->ThreadRange(1, 64)->UseRealTime();
+
+} // namespace Stats
+} // namespace Envoy
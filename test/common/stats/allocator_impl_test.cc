@@ -626,6 +626,58 @@ TEST_F(AllocatorImplTest, ForEachSinkedTextReadout) {
   EXPECT_EQ(num_iterations, 0);
 }
 
+// Sharded counters must behave exactly like plain counters.
+TEST_F(AllocatorImplTest, ShardedCounter) {
+  alloc_.setShardedCounters({"cluster.upstream_rq_total"});
+  StatName tag_extracted_name = makeStat("cluster.upstream_rq_total");
+  CounterSharedPtr sharded =
+      alloc_.makeCounter(makeStat("cluster.c1.upstream_rq_total"), tag_extracted_name, {});
+  EXPECT_EQ(sharded.get(),
+            alloc_.makeCounter(makeStat("cluster.c1.upstream_rq_total"), tag_extracted_name, {})
+                .get());
+  CounterSharedPtr plain = alloc_.makeCounter(makeStat("cluster.c1.upstream_rq_retry"),
+                                              makeStat("cluster.upstream_rq_retry"), {});
+
+  Thread::ThreadFactory& thread_factory = Thread::threadFactoryForTest();
+  const uint32_t num_threads = 12;
+  const uint32_t iters = 10000;
+  std::vector<Thread::ThreadPtr> threads;
+  absl::Notification go;
+  for (uint32_t i = 0; i < num_threads; ++i) {
+    threads.push_back(thread_factory.createThread([&]() {
+      go.WaitForNotification();
+      for (uint32_t i = 0; i < iters; ++i) {
+        sharded->inc();
+        plain->inc();
+      }
+    }));
+  }
+  EXPECT_FALSE(sharded->used());
+  go.Notify();
+  for (uint32_t i = 0; i < num_threads; ++i) {
+    threads[i]->join();
+  }
+
+  EXPECT_TRUE(sharded->used());
+  EXPECT_EQ(num_threads * iters, sharded->value());
+  EXPECT_EQ(plain->value(), sharded->value());
+  EXPECT_EQ(num_threads * iters, sharded->latch());
+  EXPECT_EQ(0, sharded->latch());
+
+  sharded->add(5);
+  sharded->reset();
+  EXPECT_EQ(0, sharded->value());
+  sharded->add(3);
+  EXPECT_EQ(3, sharded->value());
+  // As with plain counters, reset() does not discard increments pending latch.
+  EXPECT_EQ(8, sharded->latch());
+
+  sharded.reset();
+  plain.reset();
+  // Release the symbols held for the sharded names, for clearStorage().
+  alloc_.setShardedCounters({});
+}
+
 } // namespace
 } // namespace Stats
 } // namespace Envoy
@@ -109,5 +109,53 @@ TEST_F(HistogramSettingsImplTest, ScaledPercent) {
   EXPECT_EQ(settings_->buckets("abcd"), ConstSupportedBuckets({0.1, 2}));
 }
 
+using Bucket = ParentHistogram::Bucket;
+
+TEST(ExponentialHistogramTest, Empty) {
+  const ExponentialHistogram exponential =
+      ExponentialHistogram::fromBuckets({}, Histogram::Unit::Unspecified, -4, 8, 160);
+  EXPECT_EQ(8, exponential.scale_);
+  EXPECT_EQ(0, exponential.zero_count_);
+  EXPECT_TRUE(exponential.bucket_counts_.empty());
+}
+
+TEST(ExponentialHistogramTest, MapsBinMidpoints) {
+  // Bins at 0, [1, 1.1) and [10, 11); the empty bin is skipped.
+  const std::vector<Bucket> buckets{{0, 0, 2}, {1, 0.1, 3}, {5, 0.1, 0}, {10, 1, 4}};
+  const ExponentialHistogram exponential =
+      ExponentialHistogram::fromBuckets(buckets, Histogram::Unit::Unspecified, 0, 0, 160);
+  EXPECT_EQ(0, exponential.scale_);
+  EXPECT_EQ(2, exponential.zero_count_);
+  // (1, 2] holds 1.05 and (8, 16] holds 10.5.
+  EXPECT_EQ(0, exponential.offset_);
+  EXPECT_EQ(std::vector<uint64_t>({3, 0, 0, 4}), exponential.bucket_counts_);
+}
+
+TEST(ExponentialHistogramTest, ReducesScaleToFit) {
+  const std::vector<Bucket> buckets{{1, 0.1, 3}, {10, 1, 4}};
+  // At scale 2 the values span indices 0 to 13; each step down halves the indices, until at
+  // scale -1 they fit in two buckets: (1, 4] and (4, 16].
+  ExponentialHistogram exponential =
+      ExponentialHistogram::fromBuckets(buckets, Histogram::Unit::Unspecified, -4, 2, 2);
+  EXPECT_EQ(-1, exponential.scale_);
+  EXPECT_EQ(0, exponential.offset_);
+  EXPECT_EQ(std::vector<uint64_t>({3, 4}), exponential.bucket_counts_);
+
+  // The scale is never reduced below min_scale, even if that exceeds max_buckets.
+  exponential = ExponentialHistogram::fromBuckets(buckets, Histogram::Unit::Unspecified, 1, 2, 2);
+  EXPECT_EQ(1, exponential.scale_);
+  EXPECT_EQ(0, exponential.offset_);
+  EXPECT_EQ(7, exponential.bucket_counts_.size());
+}
+
+TEST(ExponentialHistogramTest, ScaledPercent) {
+  // 50% is recorded as half of PercentScale, and lands in (0.5, 1].
+  const std::vector<Bucket> buckets{{0.5 * Histogram::PercentScale, 10000, 1}};
+  const ExponentialHistogram exponential =
+      ExponentialHistogram::fromBuckets(buckets, Histogram::Unit::Percent, 0, 0, 160);
+  EXPECT_EQ(-1, exponential.offset_);
+  EXPECT_EQ(std::vector<uint64_t>({1}), exponential.bucket_counts_);
+}
+
 } // namespace Stats
 } // namespace Envoy
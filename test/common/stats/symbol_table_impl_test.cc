@@ -1,3 +1,4 @@
+#include <atomic>
 #include <string>
 
 #include "source/common/common/macros.h"
@@ -232,7 +233,6 @@ TEST_F(StatNameTest, TestSuccessfulDecode) {
 class StatNameDeathTest : public StatNameTest {
 public:
   void decodeSymbolVec(const SymbolVec& symbol_vec) {
-    Thread::LockGuard lock(table_.lock_);
     for (Symbol symbol : symbol_vec) {
       table_.fromSymbol(symbol);
     }
@@ -624,6 +624,48 @@ TEST_F(StatNameTest, MutexContentionOnExistingSymbols) {
   }
 }
 
+// Decoding doesn't take the table lock, so it must be safe against concurrent
+// allocation and release of other symbols, including growth of the table.
+TEST_F(StatNameTest, DecodeWhileEncoding) {
+  Thread::ThreadFactory& thread_factory = Thread::threadFactoryForTest();
+  std::vector<StatName> stat_names;
+  for (int i = 0; i < 100; ++i) {
+    stat_names.push_back(makeStat(absl::StrCat("cluster.c", i, ".upstream_rq_total")));
+  }
+
+  constexpr int num_threads = 8;
+  std::vector<Thread::ThreadPtr> threads;
+  std::atomic<bool> done{false};
+  absl::BlockingCounter decodes(num_threads);
+  for (int i = 0; i < num_threads; ++i) {
+    threads.push_back(thread_factory.createThread([this, i, &stat_names, &decodes]() {
+      for (int count = 0; count < 1000; ++count) {
+        const StatName stat_name = stat_names[(i + count) % stat_names.size()];
+        EXPECT_EQ(absl::StrCat("cluster.c", (i + count) % stat_names.size(), ".upstream_rq_total"),
+                  table_.toString(stat_name));
+        EXPECT_FALSE(table_.lessThan(stat_name, stat_name));
+      }
+      decodes.DecrementCount();
+    }));
+  }
+  threads.push_back(thread_factory.createThread([this, &done]() {
+    // Hold enough symbols to grow the table while it is being read, then
+    // release them for reuse.
+    while (!done) {
+      StatNamePool pool(table_);
+      for (int count = 0; count < 10000; ++count) {
+        pool.add(absl::StrCat("listener.l", count, ".cx_total"));
+      }
+    }
+  }));
+
+  decodes.Wait();
+  done = true;
+  for (auto& thread : threads) {
+    thread->join();
+  }
+}
+
 TEST_F(StatNameTest, SharedStatNameStorageSetInsertAndFind) {
   StatNameStorageSet set;
   const int iters = 10;
@@ -780,8 +822,11 @@ TEST(SymbolTableTest, Memory) {
   // Make sure we don't regress.
   // Data as of 2019/05/29:
   // symbol_table_mem_used:  1726056 (3.9x) -- does not seem to depend on STL sizes.
+  // Data as of 2026/10/17, with the decode table indexing the 1079 symbols in
+  // chunks rather than in a 2047-slot hash map (40960 -> 10456 bytes):
+  // symbol_table_mem_used:  1695552 (4.0x)
   EXPECT_MEMORY_LE(symbol_table_mem_used, string_mem_used / 3);
-  EXPECT_MEMORY_EQ(symbol_table_mem_used, 1726056);
+  EXPECT_MEMORY_EQ(symbol_table_mem_used, 1695552);
 }
 
 } // namespace Stats
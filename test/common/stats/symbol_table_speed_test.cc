@@ -3,6 +3,8 @@
 //
 // NOLINT(namespace-envoy)
 
+#include <atomic>
+
 #include "source/common/common/hash.h"
 #include "source/common/common/logger.h"
 #include "source/common/common/thread.h"
@@ -13,6 +15,7 @@
 #include "test/common/stats/make_elements_helper.h"
 #include "test/test_common/utility.h"
 
+#include "absl/strings/str_cat.h"
 #include "absl/synchronization/blocking_counter.h"
 #include "benchmark/benchmark.h"
 
@@ -63,6 +66,65 @@ static void bmCreateRace(benchmark::State& state) {
 }
 BENCHMARK(bmCreateRace)->Unit(::benchmark::kMillisecond);
 
+// Decodes stat names from several threads, as workers and the admin thread do
+// when rendering stats, optionally while another thread keeps encoding and
+// freeing names, as happens when clusters and listeners are updated.
+//
+// NOLINTNEXTLINE(readability-identifier-naming)
+static void bmDecodeRace(benchmark::State& state) {
+  const int num_decoders = state.range(0);
+  const bool encode = state.range(1) != 0;
+  Envoy::Thread::ThreadFactory& thread_factory = Envoy::Thread::threadFactoryForTest();
+  Envoy::Stats::SymbolTableImpl table;
+  Envoy::Stats::StatNamePool pool(table);
+  std::vector<Envoy::Stats::StatName> stat_names;
+  for (int i = 0; i < 1000; ++i) {
+    stat_names.push_back(pool.add(absl::StrCat("cluster.c", i, ".upstream_rq_total")));
+  }
+
+  for (auto _ : state) {
+    UNREFERENCED_PARAMETER(_);
+    std::vector<Envoy::Thread::ThreadPtr> threads;
+    Envoy::ConditionalInitializer access;
+    std::atomic<bool> done{false};
+    absl::BlockingCounter decodes(num_decoders);
+
+    for (int i = 0; i < num_decoders; ++i) {
+      threads.push_back(thread_factory.createThread([&access, &decodes, &table, &stat_names]() {
+        access.wait();
+        for (int count = 0; count < 100; ++count) {
+          for (Envoy::Stats::StatName stat_name : stat_names) {
+            benchmark::DoNotOptimize(table.toString(stat_name));
+          }
+        }
+        decodes.DecrementCount();
+      }));
+    }
+    if (encode) {
+      threads.push_back(thread_factory.createThread([&access, &done, &table]() {
+        access.wait();
+        for (uint64_t count = 0; !done; ++count) {
+          // NOLINTNEXTLINE(clang-analyzer-unix.Malloc)
+          Envoy::Stats::StatNameStorage storage(absl::StrCat("listener.l", count, ".cx_total"),
+                                                table);
+          storage.free(table);
+        }
+      }));
+    }
+
+    access.setReady();
+    decodes.Wait();
+    done = true;
+    for (auto& thread : threads) {
+      thread->join();
+    }
+  }
+}
+BENCHMARK(bmDecodeRace)
+    ->ArgsProduct({{1, 4, 16}, {0, 1}})
+    ->Unit(::benchmark::kMillisecond)
+    ->UseRealTime();
+
 // NOLINTNEXTLINE(readability-identifier-naming)
 static void bmJoinStatNames(benchmark::State& state) {
   Envoy::Stats::SymbolTableImpl symbol_table;
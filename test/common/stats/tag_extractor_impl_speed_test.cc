@@ -108,6 +108,27 @@ void BM_ExtractTags(benchmark::State& state) {
 }
 BENCHMARK(BM_ExtractTags)->DenseRange(0, 26, 1);
 
+// Extracts tags from every name above per iteration, approximating the mix seen
+// when stats are created for a new cluster or listener.
+// NOLINTNEXTLINE(readability-identifier-naming)
+void BM_ExtractTagsAll(benchmark::State& state) {
+  const Stats::TagVector tags;
+  auto tag_extractors =
+      TagProducerImpl::createTagProducer(envoy::config::metrics::v3::StatsConfig(), tags).value();
+
+  for (auto _ : state) {
+    UNREFERENCED_PARAMETER(_);
+    for (const auto& p : params) {
+      TagVector tags;
+      tag_extractors->produceTags(std::get<0>(p), tags);
+      RELEASE_ASSERT(tags.size() == std::get<1>(p),
+                     absl::StrCat("tags.size()=", tags.size(), " tags_size==", std::get<1>(p)));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * params.size());
+}
+BENCHMARK(BM_ExtractTagsAll);
+
 } // namespace
 } // namespace Stats
 } // namespace Envoy
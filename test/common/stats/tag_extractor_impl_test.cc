@@ -46,6 +46,32 @@ TEST(TagExtractorTest, RE2Variants) {
   EXPECT_EQ("cluster_name", tags.at(0).name_);
 }
 
+// An extractor ruled out by the combined prefilter skips its own match.
+TEST(TagExtractorTest, RE2PrefilterRejects) {
+  TagExtractorRe2Impl tag_extractor("cluster_name", "^cluster\\.(([^\\.]+)\\.).*");
+  tag_extractor.setPrefilterIndex(1);
+  std::string name = "cluster.test_cluster.upstream_cx_total";
+  TagVector tags;
+  IntervalSetImpl<size_t> remove_characters;
+
+  // Without prefilter results the extractor runs its own regex.
+  TagExtractionContext no_prefilter_context(name);
+  EXPECT_FALSE(no_prefilter_context.prefilterRejects(1));
+  EXPECT_TRUE(tag_extractor.extractTag(no_prefilter_context, tags, remove_characters));
+
+  TagExtractionContext matched_context(name);
+  matched_context.setPrefilterMatches({3, 1});
+  EXPECT_FALSE(matched_context.prefilterRejects(1));
+  EXPECT_TRUE(matched_context.prefilterRejects(2));
+  EXPECT_FALSE(matched_context.prefilterRejects(-1));
+  EXPECT_TRUE(tag_extractor.extractTag(matched_context, tags, remove_characters));
+
+  TagExtractionContext rejected_context(name);
+  rejected_context.setPrefilterMatches({0});
+  EXPECT_FALSE(tag_extractor.extractTag(rejected_context, tags, remove_characters));
+  EXPECT_EQ(2, tags.size());
+}
+
 TEST(TagExtractorTest, SingleSubexpression) {
   TagExtractorStdRegexImpl tag_extractor("listner_port", "^listener\\.(\\d+?\\.)");
   std::string name = "listener.80.downstream_cx_total";
@@ -12,7 +12,10 @@
 #include "source/common/stats/tag_producer_impl.h"
 #include "source/common/stats/thread_local_store.h"
 #include "source/common/thread_local/thread_local_impl.h"
+#include "source/exe/process_wide.h"
 
+#include "test/benchmark/main.h"
+#include "test/common/stats/real_thread_test_base.h"
 #include "test/common/stats/stat_test_utility.h"
 #include "test/mocks/server/server_factory_context.h"
 #include "test/test_common/simulated_time_system.h"
@@ -138,5 +141,100 @@ static void BM_StatsWithTlsAndRejectionsWithoutDot(benchmark::State& state) {
 }
 BENCHMARK(BM_StatsWithTlsAndRejectionsWithoutDot);
 
-// TODO(jmarantz): add multi-threaded variant of this test, that aggressively
-// looks up stats in multiple threads to try to trigger contention issues.
+namespace Envoy {
+
+// Mimics the first requests routed to each of many clusters created via CDS: the
+// main thread creates a scope per cluster with its regular stats, and then every
+// worker charges the response code counters for a 200 from an external request,
+// as Http::CodeStatsImpl::chargeResponseStat() does. Those counters are created
+// by name on first use, so each worker misses its TLS cache for all of them and
+// contends on the store's central lock, once per counter or, when batched via
+// Scope::countersFromStatNames(), once per cluster.
+class MultiThreadResponseCodeStatsTest : public Stats::ThreadLocalRealThreadsMixin {
+public:
+  static constexpr uint32_t NumWorkers = 8;
+  static constexpr uint32_t NumStatsPerCluster = 50;
+
+  explicit MultiThreadResponseCodeStatsTest(uint64_t num_clusters)
+      : ThreadLocalRealThreadsMixin(NumWorkers), num_clusters_(num_clusters) {
+    for (uint32_t i = 0; i < NumStatsPerCluster; ++i) {
+      cluster_stat_names_.push_back(makeStatName(absl::StrCat("stat_", i)));
+    }
+    for (absl::string_view name :
+         {"upstream_rq_completed", "upstream_rq_2xx", "upstream_rq_200",
+          "external.upstream_rq_completed", "external.upstream_rq_2xx",
+          "external.upstream_rq_200"}) {
+      response_stat_names_.push_back(makeStatName(name));
+    }
+  }
+
+  ~MultiThreadResponseCodeStatsTest() {
+    shutdownThreading();
+    // See ~MultiThreadDeferredCreationStatsTest for the sequencing of cleanup.
+    mainDispatchBlock();
+    tlsBlock();
+    mainDispatchBlock();
+  }
+
+  // Must be called on the main thread. Releases the clusters created on any
+  // previous call, so their response code counters are created again.
+  void createClusters() {
+    scopes_.clear();
+    for (uint64_t i = 0; i < num_clusters_; ++i) {
+      Stats::ScopeSharedPtr scope = store_->createScope(absl::StrCat("cluster.c", i, "."));
+      for (Stats::StatName name : cluster_stat_names_) {
+        scope->counterFromStatName(name);
+      }
+      scopes_.push_back(scope);
+    }
+  }
+
+  void chargeResponses(bool batched) {
+    std::vector<Stats::Counter*> counters(response_stat_names_.size());
+    for (const Stats::ScopeSharedPtr& scope : scopes_) {
+      if (batched) {
+        scope->countersFromStatNames(response_stat_names_, absl::MakeSpan(counters));
+        for (Stats::Counter* counter : counters) {
+          counter->inc();
+        }
+      } else {
+        for (Stats::StatName name : response_stat_names_) {
+          scope->counterFromStatName(name).inc();
+        }
+      }
+    }
+  }
+
+private:
+  const uint64_t num_clusters_;
+  std::vector<Stats::StatName> cluster_stat_names_;
+  std::vector<Stats::StatName> response_stat_names_;
+  std::vector<Stats::ScopeSharedPtr> scopes_;
+};
+
+} // namespace Envoy
+
+// Args: {batch the response code counter lookups, number of clusters}.
+// NOLINTNEXTLINE(readability-identifier-naming)
+static void BM_StatsMultiThreadResponseCodeLookups(benchmark::State& state) {
+  const bool batched = state.range(0) == 1;
+  const uint64_t num_clusters = state.range(1);
+  if (Envoy::benchmark::skipExpensiveBenchmarks() && num_clusters > 1000) {
+    state.SkipWithError("Skipping expensive benchmark");
+    return;
+  }
+
+  Envoy::ProcessWide process_wide; // Process-wide state setup/teardown (excluding grpc).
+  Envoy::MultiThreadResponseCodeStatsTest test(num_clusters);
+
+  for (auto _ : state) { // NOLINT
+    state.PauseTiming();
+    test.runOnMainBlocking([&test]() { test.createClusters(); });
+    state.ResumeTiming();
+
+    test.runOnAllWorkersBlocking([&test, batched]() { test.chargeResponses(batched); });
+  }
+}
+BENCHMARK(BM_StatsMultiThreadResponseCodeLookups)
+    ->ArgsProduct({{0, 1}, {100, 1000, 10000}})
+    ->Unit(benchmark::kMillisecond);
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <chrono>
 #include <functional>
 #include <memory>
@@ -27,6 +28,7 @@
 #include "test/mocks/stats/mocks.h"
 #include "test/mocks/thread_local/mocks.h"
 #include "test/test_common/logging.h"
+#include "test/test_common/thread_factory_for_test.h"
 #include "test/test_common/utility.h"
 
 #include "absl/strings/str_split.h"
@@ -34,6 +36,7 @@
 #include "gtest/gtest.h"
 
 using testing::_;
+using testing::AnyNumber;
 using testing::HasSubstr;
 using testing::InSequence;
 using testing::NiceMock;
@@ -67,6 +70,21 @@ public:
         },
         [num_tls_hist_cb, num_tls_histograms]() { num_tls_hist_cb(*num_tls_histograms); });
   }
+
+  // Returns the number of stats, including rejected names, held in the calling
+  // thread's TLS cache for the given scope.
+  static uint64_t numTlsCachedStats(ThreadLocalStoreImpl& thread_local_store_impl,
+                                    const Scope& scope) {
+    const auto& scope_impl = dynamic_cast<const ThreadLocalStoreImpl::ScopeImpl&>(scope);
+    const auto& scope_cache = thread_local_store_impl.tlsCache().scope_cache_;
+    auto iter = scope_cache.find(scope_impl.scope_id_);
+    if (iter == scope_cache.end()) {
+      return 0;
+    }
+    const ThreadLocalStoreImpl::TlsCacheEntry& entry = iter->second;
+    return entry.counters_.size() + entry.gauges_.size() + entry.text_readouts_.size() +
+           entry.parent_histograms_.size() + entry.rejected_stats_.size();
+  }
 };
 
 class StatsThreadLocalStoreTest : public testing::Test {
@@ -606,6 +624,54 @@ TEST_F(StatsThreadLocalStoreTest, ScopeDelete) {
   tls_.shutdownThread();
 }
 
+TEST_F(StatsThreadLocalStoreTest, CountersFromStatNames) {
+  ScopeSharedPtr scope1 = store_->createScope("scope1.");
+  StatNamePool pool(symbol_table_);
+  const StatName names[] = {pool.add("c1"), pool.add("c2"), pool.add("c1")};
+  Counter* counters[3] = {};
+
+  // Before threading is initialized there is no TLS cache; the counters are made centrally.
+  scope1->countersFromStatNames(names, absl::MakeSpan(counters));
+  EXPECT_EQ("scope1.c1", counters[0]->name());
+  EXPECT_EQ("scope1.c2", counters[1]->name());
+  EXPECT_EQ(counters[0], counters[2]);
+  Counter& c1 = *counters[0];
+  Counter& c2 = *counters[1];
+
+  store_->initializeThreading(main_thread_dispatcher_, tls_);
+  EXPECT_EQ(0, ThreadLocalStoreTestingPeer::numTlsCachedStats(*store_, *scope1));
+
+  // Misses are resolved to the existing counters and land in the TLS cache.
+  std::fill(std::begin(counters), std::end(counters), nullptr);
+  scope1->countersFromStatNames(names, absl::MakeSpan(counters));
+  EXPECT_EQ(&c1, counters[0]);
+  EXPECT_EQ(&c2, counters[1]);
+  EXPECT_EQ(&c1, counters[2]);
+  EXPECT_EQ(2, ThreadLocalStoreTestingPeer::numTlsCachedStats(*store_, *scope1));
+  EXPECT_EQ(&c1, &scope1->counterFromStatName(names[0]));
+  EXPECT_EQ(2, ThreadLocalStoreTestingPeer::numTlsCachedStats(*store_, *scope1));
+
+  // A batch mixing TLS hits and a new counter.
+  const StatName names2[] = {pool.add("c2"), pool.add("c3")};
+  Counter* counters2[2] = {};
+  scope1->countersFromStatNames(names2, absl::MakeSpan(counters2));
+  EXPECT_EQ(&c2, counters2[0]);
+  EXPECT_EQ("scope1.c3", counters2[1]->name());
+  EXPECT_EQ(counters2[1], &scope1->counterFromString("c3"));
+  EXPECT_EQ(3, ThreadLocalStoreTestingPeer::numTlsCachedStats(*store_, *scope1));
+  EXPECT_EQ(3UL, store_->counters().size());
+
+  tls_.shutdownGlobalThreading();
+  store_->shutdownThreading();
+  tls_.shutdownThread();
+
+  // After shutdown lookups bypass the TLS cache.
+  std::fill(std::begin(counters), std::end(counters), nullptr);
+  scope1->countersFromStatNames(names, absl::MakeSpan(counters));
+  EXPECT_EQ(&c1, counters[0]);
+  EXPECT_EQ(&c2, counters[1]);
+}
+
 TEST_F(StatsThreadLocalStoreTest, Eviction) {
   InSequence s;
   store_->initializeThreading(main_thread_dispatcher_, tls_);
@@ -1301,6 +1367,30 @@ TEST_F(StatsMatcherTLSTest, DoNotRejectHiddenInclusionRegex) {
   EXPECT_EQ(hidden_gauge.name(), "hidden_gauge");
 }
 
+TEST_F(StatsMatcherTLSTest, CountersFromStatNamesRejects) {
+  stats_config_.mutable_stats_matcher()->mutable_exclusion_list()->add_patterns()->set_prefix(
+      "noop");
+  store_->setStatsMatcher(
+      std::make_unique<StatsMatcherImpl>(stats_config_, symbol_table_, context_));
+
+  StatNamePool pool(symbol_table_);
+  const StatName names[] = {pool.add("noop_counter"), pool.add("counter")};
+  Counter* counters[2] = {};
+  scope_.countersFromStatNames(names, absl::MakeSpan(counters));
+  EXPECT_EQ("", counters[0]->name());
+  EXPECT_EQ(&scope_.counterFromString("noop_counter"), counters[0]);
+  EXPECT_EQ("counter", counters[1]->name());
+  EXPECT_EQ(&scope_.counterFromString("counter"), counters[1]);
+
+  envoy::config::metrics::v3::StatsConfig reject_all_config;
+  reject_all_config.mutable_stats_matcher()->set_reject_all(true);
+  store_->setStatsMatcher(
+      std::make_unique<StatsMatcherImpl>(reject_all_config, symbol_table_, context_));
+  scope_.countersFromStatNames(names, absl::MakeSpan(counters));
+  EXPECT_EQ("", counters[0]->name());
+  EXPECT_EQ("", counters[1]->name());
+}
+
 TEST_F(StatsMatcherTLSTest, DoNotRejectAllHidden) {
   envoy::config::metrics::v3::StatsConfig stats_config_;
   stats_config_.mutable_stats_matcher()->set_reject_all(true);
@@ -1769,6 +1859,43 @@ TEST_F(HistogramTest, MultiHistogramMultipleMerges) {
   EXPECT_EQ(2, validateMerge());
 }
 
+// Merges enough histograms to span several shards of the merge pool, and checks that
+// each one was merged exactly once in every pass.
+TEST_F(HistogramTest, MergeWithHelperThreads) {
+  store_->setHistogramMergeThreads(Thread::threadFactoryForTest(), 4);
+
+  constexpr uint32_t num_histograms = 10 * HistogramMergePool::ShardSize + 7;
+  std::vector<Histogram*> histograms;
+  for (uint32_t i = 0; i < num_histograms; ++i) {
+    histograms.push_back(
+        &scope_.histogramFromString(absl::StrCat("h", i), Histogram::Unit::Unspecified));
+  }
+  EXPECT_CALL(sink_, onHistogramComplete(_, _)).Times(AnyNumber());
+
+  for (uint32_t pass = 1; pass <= 3; ++pass) {
+    for (uint32_t i = 0; i < num_histograms; ++i) {
+      for (uint32_t j = 0; j <= i % 3; ++j) {
+        histograms[i]->recordValue(i);
+      }
+    }
+    bool merge_called = false;
+    store_->mergeHistograms([&merge_called]() -> void { merge_called = true; });
+    EXPECT_TRUE(merge_called);
+
+    for (uint32_t i = 0; i < num_histograms; ++i) {
+      auto& parent = static_cast<ParentHistogram&>(*histograms[i]);
+      EXPECT_EQ(i % 3 + 1, parent.intervalStatistics().sampleCount()) << parent.name();
+      EXPECT_EQ(pass * (i % 3 + 1), parent.cumulativeStatistics().sampleCount()) << parent.name();
+    }
+  }
+
+  // Reverting to main-thread merging joins the helpers.
+  store_->setHistogramMergeThreads(Thread::threadFactoryForTest(), 0);
+  histograms[0]->recordValue(1);
+  store_->mergeHistograms([]() -> void {});
+  EXPECT_EQ(1, static_cast<ParentHistogram&>(*histograms[0]).intervalStatistics().sampleCount());
+}
+
 TEST_F(HistogramTest, BasicScopeHistogramMerge) {
   ScopeSharedPtr scope1 = store_->createScope("scope1.");
 
@@ -0,0 +1,155 @@
+#include <string>
+
+#include "source/common/api/os_sys_calls_impl.h"
+#include "source/common/network/io_socket_handle_impl.h"
+#include "source/common/tcp_proxy/splice_forwarder.h"
+
+#include "test/test_common/utility.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace TcpProxy {
+namespace {
+
+#if defined(__linux__)
+
+class MockSpliceForwarderCallbacks : public SpliceForwarderCallbacks {
+public:
+  MOCK_METHOD(void, onSpliceRead, (bool from_upstream, uint64_t bytes));
+  MOCK_METHOD(void, onSpliceWrite, (bool to_upstream, uint64_t bytes));
+  MOCK_METHOD(void, onSpliceEndStream, ());
+  MOCK_METHOD(void, onSpliceError, (absl::string_view details));
+};
+
+class SpliceForwarderTest : public testing::Test {
+public:
+  SpliceForwarderTest()
+      : api_(Api::createApiForTest()), dispatcher_(api_->allocateDispatcher("test_thread")),
+        os_sys_calls_(Api::OsSysCallsSingleton::get()) {}
+
+  void SetUp() override {
+    os_fd_t downstream_fds[2];
+    os_fd_t upstream_fds[2];
+    ASSERT_EQ(0, os_sys_calls_.socketpair(AF_UNIX, SOCK_STREAM, 0, downstream_fds).return_value_);
+    ASSERT_EQ(0, os_sys_calls_.socketpair(AF_UNIX, SOCK_STREAM, 0, upstream_fds).return_value_);
+    client_fd_ = downstream_fds[0];
+    server_fd_ = upstream_fds[0];
+    ASSERT_EQ(0, os_sys_calls_.setsocketblocking(downstream_fds[1], false).return_value_);
+    ASSERT_EQ(0, os_sys_calls_.setsocketblocking(upstream_fds[1], false).return_value_);
+    downstream_ = std::make_unique<Network::IoSocketHandleImpl>(downstream_fds[1]);
+    upstream_ = std::make_unique<Network::IoSocketHandleImpl>(upstream_fds[1]);
+  }
+
+  void TearDown() override {
+    forwarder_.reset();
+    os_sys_calls_.close(client_fd_);
+    os_sys_calls_.close(server_fd_);
+  }
+
+  // Runs the dispatcher until the data is received on the fd.
+  void expectReceived(os_fd_t fd, const std::string& data) {
+    std::string received;
+    for (int i = 0; i < 1000 && received.size() < data.size(); ++i) {
+      dispatcher_->run(Event::Dispatcher::RunType::NonBlock);
+      char buffer[1024];
+      const Api::SysCallSizeResult result =
+          os_sys_calls_.recv(fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+      if (result.return_value_ > 0) {
+        received.append(buffer, result.return_value_);
+      }
+    }
+    EXPECT_EQ(data, received);
+  }
+
+  void write(os_fd_t fd, const std::string& data) {
+    ASSERT_EQ(static_cast<ssize_t>(data.size()),
+              os_sys_calls_.write(fd, data.data(), data.size()).return_value_);
+  }
+
+  Api::ApiPtr api_;
+  Event::DispatcherPtr dispatcher_;
+  Api::OsSysCalls& os_sys_calls_;
+  testing::StrictMock<MockSpliceForwarderCallbacks> callbacks_;
+  os_fd_t client_fd_;
+  os_fd_t server_fd_;
+  Network::IoHandlePtr downstream_;
+  Network::IoHandlePtr upstream_;
+  SpliceForwarderPtr forwarder_;
+};
+
+// Data is forwarded in both directions and the half closes are propagated.
+TEST_F(SpliceForwarderTest, ForwardsBothDirections) {
+  forwarder_ = SpliceForwarder::create(*dispatcher_, *downstream_, *upstream_, 0, callbacks_);
+  ASSERT_NE(nullptr, forwarder_);
+
+  EXPECT_CALL(callbacks_, onSpliceRead(false, 5));
+  EXPECT_CALL(callbacks_, onSpliceWrite(true, 5));
+  write(client_fd_, "hello");
+  expectReceived(server_fd_, "hello");
+
+  EXPECT_CALL(callbacks_, onSpliceRead(true, 5));
+  EXPECT_CALL(callbacks_, onSpliceWrite(false, 5));
+  write(server_fd_, "world");
+  expectReceived(client_fd_, "world");
+
+  // The handles owned by the connections can be closed, the forwarder uses its own duplicates.
+  downstream_->close();
+  upstream_->close();
+
+  os_sys_calls_.shutdown(client_fd_, ENVOY_SHUT_WR);
+  dispatcher_->run(Event::Dispatcher::RunType::NonBlock);
+  char buffer[1];
+  // The server sees the end of stream of the client.
+  EXPECT_EQ(0, os_sys_calls_.recv(server_fd_, buffer, sizeof(buffer), 0).return_value_);
+
+  EXPECT_CALL(callbacks_, onSpliceEndStream()).WillOnce([this]() { forwarder_.reset(); });
+  os_sys_calls_.shutdown(server_fd_, ENVOY_SHUT_WR);
+  dispatcher_->run(Event::Dispatcher::RunType::NonBlock);
+  EXPECT_EQ(nullptr, forwarder_);
+  EXPECT_EQ(0, os_sys_calls_.recv(client_fd_, buffer, sizeof(buffer), 0).return_value_);
+}
+
+// Data which doesn't fit in the pipe is forwarded as the receiver drains it.
+TEST_F(SpliceForwarderTest, ForwardsMoreThanPipeCapacity) {
+  forwarder_ = SpliceForwarder::create(*dispatcher_, *downstream_, *upstream_, 4096, callbacks_);
+  ASSERT_NE(nullptr, forwarder_);
+
+  uint64_t read = 0;
+  uint64_t written = 0;
+  EXPECT_CALL(callbacks_, onSpliceRead(false, testing::_))
+      .WillRepeatedly([&read](bool, uint64_t bytes) { read += bytes; });
+  EXPECT_CALL(callbacks_, onSpliceWrite(true, testing::_))
+      .WillRepeatedly([&written](bool, uint64_t bytes) { written += bytes; });
+
+  const std::string data(64 * 1024, 'a');
+  std::string sent;
+  std::string received;
+  for (int i = 0; i < 10000 && received.size() < data.size(); ++i) {
+    if (sent.size() < data.size()) {
+      const Api::SysCallSizeResult result =
+          os_sys_calls_.send(client_fd_, const_cast<char*>(data.data()) + sent.size(),
+                             data.size() - sent.size(), MSG_DONTWAIT);
+      if (result.return_value_ > 0) {
+        sent.append(data.data() + sent.size(), result.return_value_);
+      }
+    }
+    dispatcher_->run(Event::Dispatcher::RunType::NonBlock);
+    char buffer[4096];
+    const Api::SysCallSizeResult result =
+        os_sys_calls_.recv(server_fd_, buffer, sizeof(buffer), MSG_DONTWAIT);
+    if (result.return_value_ > 0) {
+      received.append(buffer, result.return_value_);
+    }
+  }
+  EXPECT_EQ(data, received);
+  EXPECT_EQ(data.size(), read);
+  EXPECT_EQ(data.size(), written);
+}
+
+#endif
+
+} // namespace
+} // namespace TcpProxy
+} // namespace Envoy
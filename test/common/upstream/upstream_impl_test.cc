@@ -1863,6 +1863,34 @@ TEST_F(HostImplTest, HostCluster) {
   EXPECT_EQ("", host->locality().zone());
 }
 
+// Host stats are only allocated once written, and read as zero until then.
+TEST_F(HostImplTest, LazyStats) {
+  MockClusterMockPrioritySet cluster;
+  HostSharedPtr host = makeTestHost(cluster.info_, "tcp://10.0.0.1:1234", 1);
+  EXPECT_EQ(nullptr, host->statsIfAllocated());
+
+  // Reading stats does not allocate them.
+  EXPECT_TRUE(host->canCreateConnection(ResourcePriority::Default));
+  for (const auto& [name, counter] : host->counters()) {
+    EXPECT_EQ(0, counter.get().value()) << name;
+  }
+  for (const auto& [name, gauge] : host->gauges()) {
+    EXPECT_EQ(0, gauge.get().value()) << name;
+  }
+  EXPECT_EQ(nullptr, host->statsIfAllocated());
+
+  host->stats().rq_total_.inc();
+  host->stats().rq_active_.inc();
+  ASSERT_NE(nullptr, host->statsIfAllocated());
+  EXPECT_EQ(&host->stats(), host->statsIfAllocated());
+  for (const auto& [name, counter] : host->counters()) {
+    EXPECT_EQ(name == "rq_total" ? 1 : 0, counter.get().value()) << name;
+  }
+  for (const auto& [name, gauge] : host->gauges()) {
+    EXPECT_EQ(name == "rq_active" ? 1 : 0, gauge.get().value()) << name;
+  }
+}
+
 TEST_F(HostImplTest, Weight) {
   MockClusterMockPrioritySet cluster;
 
@@ -2967,6 +2995,70 @@ TEST_F(StaticClusterImplTest, HealthyStat) {
   EXPECT_EQ(0UL, cluster->info()->endpointStats().membership_degraded_.value());
 }
 
+// An exclusion flag set without a reload for its host, as EXCLUDED_VIA_IMMEDIATE_HC_FAIL is on a
+// host that already failed active health checking, is picked up by the next reload of any host.
+TEST_F(StaticClusterImplTest, ExclusionWithoutReloadPickedUpByLaterReload) {
+  const std::string yaml = R"EOF(
+    name: addressportconfig
+    connect_timeout: 0.25s
+    type: static
+    lb_policy: random
+    load_assignment:
+        endpoints:
+          - lb_endpoints:
+            - endpoint:
+                address:
+                  socket_address:
+                    address: 10.0.0.1
+                    port_value: 11001
+            - endpoint:
+                address:
+                  socket_address:
+                    address: 10.0.0.1
+                    port_value: 11002
+            - endpoint:
+                address:
+                  socket_address:
+                    address: 10.0.0.1
+                    port_value: 11003
+  )EOF";
+
+  envoy::config::cluster::v3::Cluster cluster_config = parseClusterFromV3Yaml(yaml);
+
+  Envoy::Upstream::ClusterFactoryContextImpl factory_context(server_context_, nullptr, nullptr,
+                                                             false);
+  std::shared_ptr<StaticClusterImpl> cluster = createCluster(cluster_config, factory_context);
+
+  std::shared_ptr<MockHealthChecker> health_checker(new NiceMock<MockHealthChecker>());
+  cluster->setHealthChecker(health_checker);
+
+  MockInitializeCallback initialize_cb;
+  cluster->initialize(initialize_cb.AsStdFunction());
+
+  const HostSet& host_set = *cluster->prioritySet().hostSetsPerPriority()[0];
+  const HostVector hosts = host_set.hosts();
+  EXPECT_CALL(initialize_cb, Call).WillOnce(Return(absl::OkStatus()));
+  for (const HostSharedPtr& host : hosts) {
+    host->healthFlagClear(Host::HealthFlag::FAILED_ACTIVE_HC);
+    health_checker->runCallbacks(host, HealthTransition::Changed, HealthState::Healthy);
+  }
+  EXPECT_EQ(3UL, host_set.healthyHosts().size());
+  EXPECT_EQ(0UL, host_set.excludedHosts().size());
+
+  hosts[0]->healthFlagSet(Host::HealthFlag::FAILED_ACTIVE_HC);
+  health_checker->runCallbacks(hosts[0], HealthTransition::Changed, HealthState::Unhealthy);
+  EXPECT_EQ(2UL, host_set.healthyHosts().size());
+
+  // The failed host is told to exclude itself, which doesn't change its health.
+  hosts[0]->healthFlagSet(Host::HealthFlag::EXCLUDED_VIA_IMMEDIATE_HC_FAIL);
+  EXPECT_EQ(0UL, host_set.excludedHosts().size());
+
+  hosts[1]->healthFlagSet(Host::HealthFlag::FAILED_ACTIVE_HC);
+  health_checker->runCallbacks(hosts[1], HealthTransition::Changed, HealthState::Unhealthy);
+  EXPECT_EQ(HostVector({hosts[2]}), host_set.healthyHosts());
+  EXPECT_EQ(HostVector({hosts[0]}), host_set.excludedHosts());
+}
+
 TEST_F(StaticClusterImplTest, InitialHostsDisableHC) {
   const std::string yaml = R"EOF(
     name: staticcluster
@@ -6401,6 +6493,63 @@ TEST(HostPartitionTest, PartitionHosts) {
   EXPECT_EQ(hosts[5], update_hosts_params.excluded_hosts_per_locality->get()[1][2]);
 }
 
+// Verifies that repartitionHostsIfChanged only rebuilds the partitions whose membership changed,
+// and shares every other vector with the current host set.
+TEST(HostPartitionTest, RepartitionHostsIfChanged) {
+  std::shared_ptr<MockClusterInfo> info{new NiceMock<MockClusterInfo>()};
+  envoy::config::core::v3::Locality zone_a;
+  zone_a.set_zone("A");
+  envoy::config::core::v3::Locality zone_b;
+  zone_b.set_zone("B");
+  HostVector hosts{makeTestHost(info, "tcp://127.0.0.1:80", zone_a),
+                   makeTestHost(info, "tcp://127.0.0.1:81", zone_a),
+                   makeTestHost(info, "tcp://127.0.0.1:82", zone_b),
+                   makeTestHost(info, "tcp://127.0.0.1:83", zone_b)};
+  hosts[3]->healthFlagSet(Host::HealthFlag::DEGRADED_ACTIVE_HC);
+
+  auto hosts_per_locality = makeHostsPerLocality({{hosts[0], hosts[1]}, {hosts[2], hosts[3]}});
+
+  HostSetImpl host_set(0, false, kDefaultOverProvisioningFactor);
+  host_set.updateHosts(
+      HostSetImpl::partitionHosts(std::make_shared<const HostVector>(hosts), hosts_per_locality),
+      nullptr, hosts, {}, 0);
+  EXPECT_EQ(3, host_set.healthyHosts().size());
+  EXPECT_EQ(1, host_set.degradedHosts().size());
+
+  // A health flag that does not change the coarse health of the host requires no update.
+  hosts[3]->healthFlagSet(Host::HealthFlag::DEGRADED_EDS_HEALTH);
+  EXPECT_FALSE(ClusterImplBase::repartitionHostsIfChanged(host_set).has_value());
+  hosts[3]->healthFlagClear(Host::HealthFlag::DEGRADED_EDS_HEALTH);
+
+  // A healthy host failing only leaves the healthy partition.
+  hosts[1]->healthFlagSet(Host::HealthFlag::FAILED_ACTIVE_HC);
+  auto params = ClusterImplBase::repartitionHostsIfChanged(host_set);
+  ASSERT_TRUE(params.has_value());
+  EXPECT_EQ(&host_set.hosts(), params->hosts.get());
+  EXPECT_EQ(&host_set.hostsPerLocality(), params->hosts_per_locality.get());
+  EXPECT_EQ(&host_set.degradedHosts(), &params->degraded_hosts->get());
+  EXPECT_EQ(&host_set.degradedHostsPerLocality(), params->degraded_hosts_per_locality.get());
+  EXPECT_EQ(&host_set.excludedHosts(), &params->excluded_hosts->get());
+  EXPECT_EQ(&host_set.excludedHostsPerLocality(), params->excluded_hosts_per_locality.get());
+  EXPECT_EQ(HostVector({hosts[0], hosts[2]}), params->healthy_hosts->get());
+  EXPECT_EQ(HostVector({hosts[0]}), params->healthy_hosts_per_locality->get()[0]);
+  EXPECT_EQ(HostVector({hosts[2]}), params->healthy_hosts_per_locality->get()[1]);
+
+  host_set.updateHosts(std::move(params.value()), nullptr, {}, {}, 0);
+  EXPECT_EQ(2, host_set.healthyHosts().size());
+
+  // A degraded host that becomes healthy moves between the degraded and healthy partitions, and
+  // keeps the order of the host set.
+  hosts[3]->healthFlagClear(Host::HealthFlag::DEGRADED_ACTIVE_HC);
+  params = ClusterImplBase::repartitionHostsIfChanged(host_set);
+  ASSERT_TRUE(params.has_value());
+  EXPECT_EQ(&host_set.excludedHosts(), &params->excluded_hosts->get());
+  EXPECT_EQ(HostVector({hosts[0], hosts[2], hosts[3]}), params->healthy_hosts->get());
+  EXPECT_EQ(HostVector({hosts[2], hosts[3]}), params->healthy_hosts_per_locality->get()[1]);
+  EXPECT_TRUE(params->degraded_hosts->get().empty());
+  EXPECT_TRUE(params->degraded_hosts_per_locality->get()[1].empty());
+}
+
 TEST_F(ClusterInfoImplTest, MaxRequestsPerConnectionValidation) {
   const std::string yaml = R"EOF(
   name: cluster1
@@ -12,6 +12,8 @@
 
 #include "source/common/config/protobuf_link_hacks.h"
 #include "source/common/config/utility.h"
+#include "source/common/event/real_time_system.h"
+#include "source/common/memory/stats.h"
 #include "source/common/singleton/manager_impl.h"
 #include "source/extensions/clusters/eds/eds.h"
 #include "source/extensions/config_subscription/grpc/grpc_mux_impl.h"
@@ -30,6 +32,7 @@
 #include "test/mocks/server/options.h"
 #include "test/mocks/ssl/mocks.h"
 #include "test/mocks/upstream/cluster_manager.h"
+#include "test/mocks/upstream/host.h"
 #include "test/test_common/test_runtime.h"
 #include "test/test_common/utility.h"
 
@@ -113,9 +116,11 @@ public:
   }
 
   // Set up an EDS config with multiple priorities, localities, weights and make sure
-  // they are loaded as expected.
+  // they are loaded as expected. If unhealthy_host is set, only that host has the opposite
+  // health status. The wall time of the update itself is recorded in last_update_seconds_.
   void priorityAndLocalityWeightedHelper(bool ignore_unknown_dynamic_fields, size_t num_hosts,
-                                         bool healthy) {
+                                         bool healthy,
+                                         absl::optional<size_t> unhealthy_host = absl::nullopt) {
     state_.PauseTiming();
 
     envoy::config::endpoint::v3::ClusterLoadAssignment cluster_load_assignment;
@@ -133,7 +138,7 @@ public:
     uint32_t port = 1000;
     for (size_t i = 0; i < num_hosts; ++i) {
       auto* lb_endpoint = endpoints->add_lb_endpoints();
-      if (healthy) {
+      if (healthy != (unhealthy_host == i)) {
         lb_endpoint->set_health_status(envoy::config::core::v3::HEALTHY);
       } else {
         lb_endpoint->set_health_status(envoy::config::core::v3::UNHEALTHY);
@@ -152,7 +157,9 @@ public:
     response->set_version_info(fmt::format("version-{}", version_++));
     auto* resource = response->mutable_resources()->Add();
     resource->PackFrom(cluster_load_assignment);
+    const uint64_t start_bytes = Memory::Stats::totalCurrentlyAllocated();
     state_.ResumeTiming();
+    const MonotonicTime start_time = time_system_.monotonicTime();
     if (use_unified_mux_) {
       dynamic_cast<Config::XdsMux::GrpcMuxSotw&>(*grpc_mux_)
           .grpcStreamForTest()
@@ -164,6 +171,36 @@ public:
     }
     ASSERT(cluster_->prioritySet().hostSetsPerPriority()[1]->hostsPerLocality().get()[0].size() ==
            num_hosts);
+    last_update_seconds_ =
+        std::chrono::duration<double>(time_system_.monotonicTime() - start_time).count();
+    state_.PauseTiming();
+    // Only meaningful in tcmalloc builds; otherwise this reports zero. The response is released
+    // during the update, so this may be slightly negative for very small updates.
+    const int64_t consumed_bytes =
+        static_cast<int64_t>(Memory::Stats::totalCurrentlyAllocated() - start_bytes);
+    state_.counters["bytes_per_host"] = static_cast<double>(consumed_bytes) / num_hosts;
+    state_.ResumeTiming();
+  }
+
+  // Ejects and then unejects a single host of the cluster through its outlier detector, as a
+  // failing upstream would, and records the wall time of both health updates in
+  // last_update_seconds_.
+  void outlierEjectionHelper() {
+    state_.PauseTiming();
+    if (outlier_detector_ == nullptr) {
+      outlier_detector_ = std::make_shared<NiceMock<Outlier::MockDetector>>();
+      cluster_->setOutlierDetector(outlier_detector_);
+    }
+    const HostVector& hosts = cluster_->prioritySet().hostSetsPerPriority()[1]->hosts();
+    const HostSharedPtr host = hosts[hosts.size() / 2];
+    state_.ResumeTiming();
+    const MonotonicTime start_time = time_system_.monotonicTime();
+    host->healthFlagSet(Host::HealthFlag::FAILED_OUTLIER_CHECK);
+    outlier_detector_->runCallbacks(host);
+    host->healthFlagClear(Host::HealthFlag::FAILED_OUTLIER_CHECK);
+    outlier_detector_->runCallbacks(host);
+    last_update_seconds_ =
+        std::chrono::duration<double>(time_system_.monotonicTime() - start_time).count();
   }
 
   NiceMock<Server::Configuration::MockServerFactoryContext> server_context_;
@@ -174,6 +211,9 @@ public:
   const std::string type_url_;
   uint64_t version_{};
   bool initialized_{};
+  double last_update_seconds_{};
+  Event::RealTimeSystem time_system_;
+  std::shared_ptr<NiceMock<Outlier::MockDetector>> outlier_detector_;
   Stats::Scope& scope_{*stats_.rootScope()};
   Config::SubscriptionStats subscription_stats_;
   envoy::config::cluster::v3::Cluster eds_cluster_;
@@ -243,3 +283,66 @@ static void healthOnlyUpdate(State& state) {
 }
 
 BENCHMARK(healthOnlyUpdate)->Ranges({{1, 100000}, {false, true}})->Unit(benchmark::kMillisecond);
+
+// The following benchmarks measure single host churn in a large cluster. Only the wall time of
+// the churn itself is reported, not that of loading the cluster. Adding a host rebuilds the host
+// set of its priority, while an EDS health flip only rebuilds the partitions it changes.
+static void singleHostAddUpdate(State& state) {
+  Envoy::Thread::MutexBasicLockable lock;
+  Envoy::Logger::Context logging_state(spdlog::level::warn,
+                                       Envoy::Logger::Logger::DEFAULT_LOG_FORMAT, lock, false);
+  for (auto _ : state) { // NOLINT: Silences warning about dead store
+    Envoy::Upstream::EdsSpeedTest speed_test(state, false);
+    uint32_t endpoints = skipExpensiveBenchmarks() ? 1 : state.range(0);
+
+    speed_test.priorityAndLocalityWeightedHelper(true, endpoints, true);
+    speed_test.priorityAndLocalityWeightedHelper(true, endpoints + 1, true);
+    state.SetIterationTime(speed_test.last_update_seconds_);
+  }
+}
+
+BENCHMARK(singleHostAddUpdate)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
+static void singleHostHealthUpdate(State& state) {
+  Envoy::Thread::MutexBasicLockable lock;
+  Envoy::Logger::Context logging_state(spdlog::level::warn,
+                                       Envoy::Logger::Logger::DEFAULT_LOG_FORMAT, lock, false);
+  for (auto _ : state) { // NOLINT: Silences warning about dead store
+    Envoy::Upstream::EdsSpeedTest speed_test(state, false);
+    uint32_t endpoints = skipExpensiveBenchmarks() ? 1 : state.range(0);
+
+    speed_test.priorityAndLocalityWeightedHelper(true, endpoints, true);
+    speed_test.priorityAndLocalityWeightedHelper(true, endpoints, true, endpoints / 2);
+    state.SetIterationTime(speed_test.last_update_seconds_);
+  }
+}
+
+BENCHMARK(singleHostHealthUpdate)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
+static void singleHostOutlierEjection(State& state) {
+  Envoy::Thread::MutexBasicLockable lock;
+  Envoy::Logger::Context logging_state(spdlog::level::warn,
+                                       Envoy::Logger::Logger::DEFAULT_LOG_FORMAT, lock, false);
+  for (auto _ : state) { // NOLINT: Silences warning about dead store
+    Envoy::Upstream::EdsSpeedTest speed_test(state, false);
+    uint32_t endpoints = skipExpensiveBenchmarks() ? 1 : state.range(0);
+
+    speed_test.priorityAndLocalityWeightedHelper(true, endpoints, true);
+    speed_test.outlierEjectionHelper();
+    state.SetIterationTime(speed_test.last_update_seconds_);
+  }
+}
+
+BENCHMARK(singleHostOutlierEjection)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
@@ -782,6 +782,67 @@ TEST_F(EdsTest, Hostname) {
   EXPECT_EQ(hosts[0]->hostname(), "foo");
 }
 
+// An EDS health status change that leaves the hosts unchanged keeps the host and per locality
+// vectors of the host set, and only rebuilds the affected partitions.
+TEST_F(EdsTest, EndpointHealthStatusUpdateKeepsHostVectors) {
+  envoy::config::endpoint::v3::ClusterLoadAssignment cluster_load_assignment;
+  cluster_load_assignment.set_cluster_name("fare");
+  int port = 80;
+  for (const char* zone : {"zone1", "zone2"}) {
+    auto* endpoints = cluster_load_assignment.add_endpoints();
+    endpoints->mutable_locality()->set_zone(zone);
+    for (int i = 0; i < 2; ++i) {
+      auto* socket_address = endpoints->add_lb_endpoints()
+                                 ->mutable_endpoint()
+                                 ->mutable_address()
+                                 ->mutable_socket_address();
+      socket_address->set_address("1.2.3.4");
+      socket_address->set_port_value(port++);
+    }
+  }
+
+  initialize();
+  doOnConfigUpdateVerifyNoThrow(cluster_load_assignment);
+  EXPECT_TRUE(initialized_);
+
+  const HostSet& host_set = *cluster_->prioritySet().hostSetsPerPriority()[0];
+  const HostVector* hosts = &host_set.hosts();
+  const HostsPerLocality* hosts_per_locality = &host_set.hostsPerLocality();
+  const HostVector* degraded_hosts = &host_set.degradedHosts();
+  EXPECT_EQ(4, host_set.healthyHosts().size());
+
+  uint32_t priority_updates = 0;
+  auto priority_update_cb = cluster_->prioritySet().addPriorityUpdateCb(
+      [&](uint32_t, const HostVector& added, const HostVector& removed) {
+        EXPECT_TRUE(added.empty());
+        EXPECT_TRUE(removed.empty());
+        ++priority_updates;
+        return absl::OkStatus();
+      });
+
+  cluster_load_assignment.mutable_endpoints(1)->mutable_lb_endpoints(0)->set_health_status(
+      envoy::config::core::v3::UNHEALTHY);
+  doOnConfigUpdateVerifyNoThrow(cluster_load_assignment);
+  EXPECT_EQ(1, priority_updates);
+  EXPECT_EQ(hosts, &host_set.hosts());
+  EXPECT_EQ(hosts_per_locality, &host_set.hostsPerLocality());
+  EXPECT_EQ(degraded_hosts, &host_set.degradedHosts());
+  EXPECT_EQ(HostVector({(*hosts)[0], (*hosts)[1], (*hosts)[3]}), host_set.healthyHosts());
+  EXPECT_EQ(HostVector({(*hosts)[3]}), host_set.healthyHostsPerLocality().get()[1]);
+
+  // A weight change alone still updates the priority, with the same partitions.
+  const HostVector* healthy_hosts = &host_set.healthyHosts();
+  cluster_load_assignment.mutable_endpoints(0)
+      ->mutable_lb_endpoints(0)
+      ->mutable_load_balancing_weight()
+      ->set_value(10);
+  doOnConfigUpdateVerifyNoThrow(cluster_load_assignment);
+  EXPECT_EQ(2, priority_updates);
+  EXPECT_EQ(10, (*hosts)[0]->weight());
+  EXPECT_EQ(hosts, &host_set.hosts());
+  EXPECT_EQ(healthy_hosts, &host_set.healthyHosts());
+}
+
 TEST_F(EdsTest, UseHostnameForHealthChecks) {
   envoy::config::endpoint::v3::ClusterLoadAssignment cluster_load_assignment;
   auto* endpoint = cluster_load_assignment.add_endpoints()->add_lb_endpoints()->mutable_endpoint();
@@ -36,5 +36,26 @@ BaseTester::BaseTester(uint64_t num_hosts, uint32_t weighted_subset_percent, uin
       random_.random(), absl::nullopt);
 }
 
+void BaseTester::updateHosts(bool churn) {
+  auto hosts =
+      std::make_shared<Upstream::HostVector>(priority_set_.hostSetsPerPriority()[0]->hosts());
+  Upstream::HostVector hosts_added;
+  Upstream::HostVector hosts_removed;
+  if (churn && removed_host_ == nullptr) {
+    removed_host_ = hosts->front();
+    hosts->erase(hosts->begin());
+    hosts_removed.push_back(removed_host_);
+  } else if (churn) {
+    hosts->push_back(removed_host_);
+    hosts_added.push_back(removed_host_);
+    removed_host_ = nullptr;
+  }
+
+  Upstream::HostsPerLocalityConstSharedPtr hosts_per_locality =
+      Upstream::makeHostsPerLocality({*hosts});
+  priority_set_.updateHosts(0, Upstream::HostSetImpl::partitionHosts(hosts, hosts_per_locality),
+                            {}, hosts_added, hosts_removed, random_.random(), absl::nullopt);
+}
+
 } // namespace Upstream
 } // namespace Envoy
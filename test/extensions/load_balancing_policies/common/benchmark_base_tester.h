@@ -25,6 +25,10 @@ public:
   BaseTester(uint64_t num_hosts, uint32_t weighted_subset_percent = 0, uint32_t weight = 0,
              bool attach_metadata = false);
 
+  // Updates the hosts of priority 0. If churn is true, the first host is removed, or added back
+  // if the previous call removed it; otherwise the hosts are updated unchanged.
+  void updateHosts(bool churn);
+
   Envoy::Thread::MutexBasicLockable lock_;
   // Reduce default log level to warn while running this benchmark to avoid problems due to
   // excessive debug logging in upstream_impl.cc
@@ -44,6 +48,7 @@ public:
   NiceMock<Runtime::MockLoader> runtime_;
   Random::RandomGeneratorImpl random_;
   std::shared_ptr<Upstream::MockClusterInfo> info_{new NiceMock<Upstream::MockClusterInfo>()};
+  Upstream::HostSharedPtr removed_host_;
 };
 
 class TestLoadBalancerContext : public Upstream::LoadBalancerContextBase {
@@ -9,9 +9,14 @@ namespace {
 
 class LeastRequestTester : public BaseTester {
 public:
-  LeastRequestTester(uint64_t num_hosts, uint32_t choice_count) : BaseTester(num_hosts) {
+  LeastRequestTester(uint64_t num_hosts, uint32_t choice_count, bool full_scan = false)
+      : BaseTester(num_hosts) {
     envoy::extensions::load_balancing_policies::least_request::v3::LeastRequest lr_lb_config;
     lr_lb_config.mutable_choice_count()->set_value(choice_count);
+    if (full_scan) {
+      lr_lb_config.set_selection_method(
+          envoy::extensions::load_balancing_policies::least_request::v3::LeastRequest::FULL_SCAN);
+    }
     lb_ =
         std::make_unique<LeastRequestLoadBalancer>(priority_set_, &local_priority_set_, stats_,
                                                    runtime_, random_, 50, lr_lb_config, simTime());
@@ -62,6 +67,32 @@ BENCHMARK(benchmarkLeastRequestLoadBalancerChooseHost)
     ->Args({100, 100, 1000000})
     ->Unit(::benchmark::kMillisecond);
 
+// Measures a single pick in large clusters where only every 100th host has active requests, as is
+// typical when most hosts of a large cluster are idle. Args: {num_hosts, choice_count}, where a
+// choice_count of 0 selects the full scan method.
+void benchmarkLeastRequestLoadBalancerPick(::benchmark::State& state) {
+  const uint64_t num_hosts = state.range(0);
+  const uint64_t choice_count = state.range(1);
+  LeastRequestTester tester(num_hosts, std::max<uint64_t>(choice_count, 2), choice_count == 0);
+  const HostVector& hosts = tester.priority_set_.hostSetsPerPriority()[0]->hosts();
+  for (uint64_t i = 0; i < hosts.size(); i += 100) {
+    hosts[i]->stats().rq_active_.set(1 + i % 7);
+  }
+  TestLoadBalancerContext context;
+
+  for (auto _ : state) { // NOLINT: Silences warning about dead store
+    ::benchmark::DoNotOptimize(tester.lb_->chooseHost(&context).host);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(benchmarkLeastRequestLoadBalancerPick)
+    ->Args({1000, 0})
+    ->Args({1000, 2})
+    ->Args({1000, 10})
+    ->Args({10000, 0})
+    ->Args({10000, 2})
+    ->Args({10000, 10});
+
 } // namespace
 } // namespace Upstream
 } // namespace Envoy
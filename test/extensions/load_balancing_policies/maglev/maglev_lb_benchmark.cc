@@ -1,3 +1,8 @@
+// Note: this should be run with --compilation_mode=opt. The
+// :maglev_lb_force_original_impl_benchmark target runs the same benchmarks against the original
+// table representation, which stores a host pointer per table entry, to compare the memory and
+// lookup cost of the two representations.
+
 #include "source/extensions/load_balancing_policies/maglev/maglev_lb.h"
 
 #include "test/benchmark/main.h"
@@ -75,6 +80,49 @@ BENCHMARK(benchmarkMaglevLoadBalancerBuildTable)
     ->Arg(100)
     ->Arg(200)
     ->Arg(500)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Unit(::benchmark::kMillisecond);
+
+// Measures host selection alone, without the bookkeeping of
+// benchmarkMaglevLoadBalancerChooseHost, to compare the lookup cost of the compact and original
+// table representations.
+void benchmarkMaglevLoadBalancerLookup(::benchmark::State& state) {
+  const uint64_t num_hosts = state.range(0);
+  MaglevTester tester(num_hosts);
+  ASSERT_TRUE(tester.maglev_lb_->initialize().ok());
+  LoadBalancerPtr lb = tester.maglev_lb_->factory()->create(tester.lb_params_);
+  TestLoadBalancerContext context;
+
+  uint64_t i = 0;
+  for (auto _ : state) { // NOLINT: Silences warning about dead store
+    tester.hash_policy_->hash_key_ = hashInt(i++);
+    ::benchmark::DoNotOptimize(lb->chooseHost(&context).host);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(benchmarkMaglevLoadBalancerLookup)->Arg(100)->Arg(1000)->Arg(10000);
+
+// Measures the main thread cost of a host set update after the initial build. With churn, one host
+// is removed or added back on every iteration, which requires a rebuild; without churn the
+// hosts are updated unchanged, which does not.
+void benchmarkMaglevLoadBalancerHostChurn(::benchmark::State& state) {
+  const uint64_t num_hosts = state.range(0);
+  const bool churn = state.range(1) != 0;
+  MaglevTester tester(num_hosts);
+  ASSERT_TRUE(tester.maglev_lb_->initialize().ok());
+
+  for (auto _ : state) { // NOLINT: Silences warning about dead store
+    tester.updateHosts(churn);
+  }
+}
+BENCHMARK(benchmarkMaglevLoadBalancerHostChurn)
+    ->Args({100, 0})
+    ->Args({100, 1})
+    ->Args({1000, 0})
+    ->Args({1000, 1})
+    ->Args({10000, 0})
+    ->Args({10000, 1})
     ->Unit(::benchmark::kMillisecond);
 
 void benchmarkMaglevLoadBalancerHostLoss(::benchmark::State& state) {
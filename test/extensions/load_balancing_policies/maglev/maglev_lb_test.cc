@@ -474,6 +474,48 @@ TEST_F(MaglevLoadBalancerTest, BasicStability) {
   }
 }
 
+// Only the tables of priorities whose hosts changed are rebuilt on a host set update. As the
+// stats are set by every table build, they show which priority was built last.
+TEST_F(MaglevLoadBalancerTest, UnchangedPriorityNotRebuilt) {
+  host_set_.hosts_ = {makeTestHost(info_, "tcp://127.0.0.1:90"),
+                      makeTestHost(info_, "tcp://127.0.0.1:91")};
+  host_set_.healthy_hosts_ = host_set_.hosts_;
+  MockHostSet& failover_host_set = *priority_set_.getMockHostSet(1);
+  failover_host_set.hosts_ = {makeTestHost(info_, "tcp://127.0.0.1:92"),
+                              makeTestHost(info_, "tcp://127.0.0.1:93"),
+                              makeTestHost(info_, "tcp://127.0.0.1:94")};
+  failover_host_set.healthy_hosts_ = failover_host_set.hosts_;
+  init(7);
+
+  // Priority 1 was built last.
+  EXPECT_EQ(2, lb_->stats().min_entries_per_host_.value());
+  EXPECT_EQ(3, lb_->stats().max_entries_per_host_.value());
+
+  // Changing the hosts of priority 0 only rebuilds its table.
+  host_set_.hosts_ = {
+      makeTestHost(info_, "tcp://127.0.0.1:90"), makeTestHost(info_, "tcp://127.0.0.1:91"),
+      makeTestHost(info_, "tcp://127.0.0.1:92"), makeTestHost(info_, "tcp://127.0.0.1:93"),
+      makeTestHost(info_, "tcp://127.0.0.1:94"), makeTestHost(info_, "tcp://127.0.0.1:95")};
+  host_set_.healthy_hosts_ = host_set_.hosts_;
+  host_set_.runCallbacks({}, {});
+  EXPECT_EQ(1, lb_->stats().min_entries_per_host_.value());
+  EXPECT_EQ(2, lb_->stats().max_entries_per_host_.value());
+
+  // An update of priority 1 which does not change its hosts rebuilds nothing.
+  failover_host_set.runCallbacks({}, {});
+  EXPECT_EQ(1, lb_->stats().min_entries_per_host_.value());
+  EXPECT_EQ(2, lb_->stats().max_entries_per_host_.value());
+
+  // The reused table of priority 1 is still used once priority 0 has no healthy hosts.
+  host_set_.healthy_hosts_ = {};
+  host_set_.runCallbacks({}, {});
+  LoadBalancerPtr lb = lb_->factory()->create(lb_params_);
+  TestLoadBalancerContext context(0);
+  const HostConstSharedPtr host = lb->chooseHost(&context).host;
+  EXPECT_NE(failover_host_set.hosts_.end(),
+            std::find(failover_host_set.hosts_.begin(), failover_host_set.hosts_.end(), host));
+}
+
 // Weighted sanity test.
 TEST_F(MaglevLoadBalancerTest, Weighted) {
   host_set_.hosts_ = {makeTestHost(info_, "tcp://127.0.0.1:90", 1),
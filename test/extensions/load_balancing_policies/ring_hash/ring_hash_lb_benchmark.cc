@@ -48,6 +48,28 @@ BENCHMARK(benchmarkRingHashLoadBalancerBuildRing)
     ->Args({500, 256000})
     ->Unit(::benchmark::kMillisecond);
 
+// Measures the main thread cost of a host set update after the initial build. With churn, one host
+// is removed or added back on every iteration, which requires a rebuild; without churn the
+// hosts are updated unchanged, which does not.
+void benchmarkRingHashLoadBalancerHostChurn(::benchmark::State& state) {
+  const uint64_t num_hosts = state.range(0);
+  const bool churn = state.range(1) != 0;
+  RingHashTester tester(num_hosts, 65536);
+  ASSERT_TRUE(tester.ring_hash_lb_->initialize().ok());
+
+  for (auto _ : state) { // NOLINT: Silences warning about dead store
+    tester.updateHosts(churn);
+  }
+}
+BENCHMARK(benchmarkRingHashLoadBalancerHostChurn)
+    ->Args({100, 0})
+    ->Args({100, 1})
+    ->Args({1000, 0})
+    ->Args({1000, 1})
+    ->Args({10000, 0})
+    ->Args({10000, 1})
+    ->Unit(::benchmark::kMillisecond);
+
 void benchmarkRingHashLoadBalancerChooseHost(::benchmark::State& state) {
   for (auto _ : state) { // NOLINT: Silences warning about dead store
     // Do not time the creation of the ring.
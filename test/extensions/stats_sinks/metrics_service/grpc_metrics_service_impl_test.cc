@@ -14,9 +14,11 @@
 
 using namespace std::chrono_literals;
 using testing::_;
+using testing::ElementsAre;
 using testing::InSequence;
 using testing::Invoke;
 using testing::NiceMock;
+using testing::Return;
 
 namespace Envoy {
 namespace Extensions {
@@ -388,6 +390,45 @@ TEST_F(MetricsServiceSinkTest, HistogramEmitModeHistogram) {
   sink.flush(snapshot_);
 }
 
+// This test will only emit native histograms.
+TEST_F(MetricsServiceSinkTest, HistogramEmitModeNativeHistogram) {
+  addHistogramToSnapshot("test_histogram");
+  ON_CALL(*histogram_storage_.back(), detailedIntervalBuckets())
+      .WillByDefault(Return(std::vector<Stats::ParentHistogram::Bucket>{
+          {0, 0, 2}, {1, 0.1, 3}, {10, 1, 4}, {12, 1, 1}}));
+  addHistogramToSnapshot("empty_histogram");
+
+  MetricsServiceSink<envoy::service::metrics::v3::StreamMetricsMessage,
+                     envoy::service::metrics::v3::StreamMetricsResponse>
+      sink(streamer_, true, false,
+           envoy::config::metrics::v3::HistogramEmitMode::NATIVE_HISTOGRAM);
+
+  EXPECT_CALL(*streamer_, send(_)).WillOnce(Invoke([](MetricsPtr&& metrics) {
+    ASSERT_EQ(2, metrics->size());
+    EXPECT_EQ("test_histogram", (*metrics)[0].name());
+
+    const auto& histogram = (*metrics)[0].metric(0).histogram();
+    EXPECT_EQ(0, histogram.bucket_size());
+    // 1.05, 10.5 and 12.5 span 3.6 powers of two, which fits in 160 buckets at schema 5.
+    EXPECT_EQ(5, histogram.schema());
+    EXPECT_EQ(2, histogram.zero_count());
+    ASSERT_EQ(3, histogram.positive_span_size());
+    EXPECT_EQ(3, histogram.positive_span(0).offset());
+    EXPECT_EQ(1, histogram.positive_span(0).length());
+    EXPECT_EQ(105, histogram.positive_span(1).offset());
+    EXPECT_EQ(1, histogram.positive_span(1).length());
+    EXPECT_EQ(7, histogram.positive_span(2).offset());
+    EXPECT_EQ(1, histogram.positive_span(2).length());
+    EXPECT_THAT(histogram.positive_delta(), ElementsAre(3, 1, -3));
+
+    // An empty native histogram still carries a span to mark it as native.
+    const auto& empty = (*metrics)[1].metric(0).histogram();
+    EXPECT_EQ(1, empty.positive_span_size());
+    EXPECT_EQ(0, empty.positive_delta_size());
+  }));
+  sink.flush(snapshot_);
+}
+
 } // namespace
 } // namespace MetricsService
 } // namespace StatSinks
@@ -436,6 +436,47 @@ TEST_F(OtlpMetricsFlusherTests, DeltaHistogramMetric) {
   expectHistogram(metricAt(1, metrics), getTagExtractedName("test_histogram2"), true);
 }
 
+TEST_F(OtlpMetricsFlusherTests, ExponentialHistogramMetric) {
+  envoy::extensions::stat_sinks::open_telemetry::v3::SinkConfig sink_config;
+  sink_config.set_report_histograms_as_exponential(true);
+  OtlpMetricsFlusherImpl flusher(
+      std::make_shared<OtlpOptions>(sink_config, Tracers::OpenTelemetry::Resource{}));
+
+  addHistogramToSnapshot("test_histogram");
+  ON_CALL(*histogram_storage_.back(), detailedTotalBuckets())
+      .WillByDefault(Return(std::vector<Stats::ParentHistogram::Bucket>{
+          {0, 0, 2}, {1, 0.1, 3}, {10, 1, 4}, {1000, 10, 1}}));
+
+  MetricsExportRequestSharedPtr metrics = flusher.flush(snapshot_);
+  expectMetricsCount(metrics, 1);
+  const auto& metric = metricAt(0, metrics);
+  EXPECT_EQ(getTagExtractedName("test_histogram"), metric.name());
+  EXPECT_FALSE(metric.has_histogram());
+  ASSERT_TRUE(metric.has_exponential_histogram());
+  EXPECT_EQ(AggregationTemporality::AGGREGATION_TEMPORALITY_CUMULATIVE,
+            metric.exponential_histogram().aggregation_temporality());
+  ASSERT_EQ(1, metric.exponential_histogram().data_points().size());
+
+  const auto& data_point = metric.exponential_histogram().data_points()[0];
+  EXPECT_EQ(expected_time_ns_, data_point.time_unix_nano());
+  EXPECT_EQ(10, data_point.count());
+  expectAttributes(data_point.attributes(), "hist_key", "hist_val");
+  EXPECT_EQ(2, data_point.zero_count());
+
+  // The values span 10 powers of two, so 160 buckets allow a scale of at most 4, at which
+  // 1.05 and 1005 fall in buckets 1 and 159.
+  EXPECT_EQ(4, data_point.scale());
+  EXPECT_EQ(1, data_point.positive().offset());
+  EXPECT_EQ(159, data_point.positive().bucket_counts().size());
+  uint64_t total = 0;
+  for (uint64_t count : data_point.positive().bucket_counts()) {
+    total += count;
+  }
+  EXPECT_EQ(8, total);
+  EXPECT_EQ(3, data_point.positive().bucket_counts()[0]);
+  EXPECT_EQ(1, *data_point.positive().bucket_counts().rbegin());
+}
+
 TEST_F(OtlpMetricsFlusherTests, SetResourceAttributes) {
   OtlpMetricsFlusherImpl flusher(
       otlpOptions(true, false, true, true, "", {{"key_foo", "val_foo"}}));
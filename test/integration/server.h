@@ -384,6 +384,8 @@ public:
   void initializeThreading(Event::Dispatcher&, ThreadLocal::Instance&) override {}
   void shutdownThreading() override {}
   void mergeHistograms(PostMergeCb cb) override { merge_cb_ = cb; }
+  void setHistogramMergeThreads(Thread::ThreadFactory&, uint32_t) override {}
+  void setShardedCounters(const std::vector<std::string>&) override {}
 
   void runMergeCallback() { merge_cb_(); }
 
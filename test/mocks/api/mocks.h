@@ -145,6 +145,9 @@ public:
   // Api::LinuxOsSysCalls
   MOCK_METHOD(SysCallIntResult, sched_getaffinity, (pid_t pid, size_t cpusetsize, cpu_set_t* mask));
   MOCK_METHOD(SysCallIntResult, setns, (int fd, int nstype), (const));
+  MOCK_METHOD(SysCallIntResult, pipe2, (int pipefd[2], int flags));
+  MOCK_METHOD(SysCallSizeResult, splice, (int fd_in, int fd_out, size_t length, unsigned int flags));
+  MOCK_METHOD(SysCallIntResult, fcntl, (int fd, int cmd, int arg));
 };
 #endif
 
@@ -109,6 +109,8 @@ public:
   MOCK_METHOD(const absl::optional<std::chrono::milliseconds>, grpcTimeoutHeaderOffset, (),
               (const));
   MOCK_METHOD(float, perUpstreamPreconnectRatio, (), (const));
+  MOCK_METHOD(const absl::optional<std::chrono::milliseconds>, adaptivePreconnectWindow, (),
+              (const));
   MOCK_METHOD(float, peekaheadRatio, (), (const));
   MOCK_METHOD(uint32_t, perConnectionBufferLimitBytes, (), (const));
   MOCK_METHOD(uint64_t, features, (), (const));
@@ -3,8 +3,10 @@
 
 #include "source/common/buffer/buffer_impl.h"
 #include "source/common/http/header_map_impl.h"
+#include "source/common/memory/stats.h"
 #include "source/common/stats/custom_stat_namespaces_impl.h"
 #include "source/common/stats/thread_local_store.h"
+#include "source/server/admin/prometheus_stats.h"
 #include "source/server/admin/stats_handler.h"
 
 #include "test/benchmark/main.h"
@@ -193,24 +195,51 @@ public:
    * Issues an admin request against the stats saved in store_.
    */
   uint64_t handlerStats(const StatsParams& params) {
-    Buffer::OwnedImpl data;
-    if (params.format_ == StatsFormat::Prometheus) {
-      StatsHandler::prometheusRender(*store_, custom_namespaces_, cm_, params, data);
-      return data.length();
-    }
-    Admin::RequestPtr request = StatsHandler::makeRequest(*store_, params, cm_);
+    uint64_t peak_memory;
+    return handlerStats(params, peak_memory);
+  }
+
+  /**
+   * Issues an admin request against the stats saved in store_, tracking the
+   * peak memory allocated while serving it, as sampled between chunks.
+   */
+  uint64_t handlerStats(const StatsParams& params, uint64_t& peak_memory) {
+    Admin::RequestPtr request =
+        params.format_ == StatsFormat::Prometheus
+            ? StatsHandler::makePrometheusRequest(*store_, custom_namespaces_, cm_, params)
+            : StatsHandler::makeRequest(*store_, params, cm_);
+    const uint64_t initial_memory = Memory::Stats::totalCurrentlyAllocated();
+    peak_memory = 0;
     auto response_headers = Http::ResponseHeaderMapImpl::create();
     request->start(*response_headers);
+    Buffer::OwnedImpl data;
     uint64_t count = 0;
     bool more = true;
     do {
       more = request->nextChunk(data);
+      peak_memory = std::max(peak_memory, Memory::Stats::totalCurrentlyAllocated());
       count += data.length();
       data.drain(data.length());
     } while (more);
+    peak_memory = peak_memory > initial_memory ? peak_memory - initial_memory : 0;
     return count;
   }
 
+  /**
+   * Renders all the stats as prometheus into a single buffer, as was done
+   * before the exposition was streamed, for comparison.
+   */
+  uint64_t bufferedPrometheusStats(const StatsParams& params, uint64_t& peak_memory) {
+    const uint64_t initial_memory = Memory::Stats::totalCurrentlyAllocated();
+    Buffer::OwnedImpl data;
+    PrometheusStatsFormatter::statsAsPrometheus(store_->counters(), store_->gauges(),
+                                                store_->histograms(), {}, cm_, data, params,
+                                                custom_namespaces_);
+    const uint64_t final_memory = Memory::Stats::totalCurrentlyAllocated();
+    peak_memory = final_memory > initial_memory ? final_memory - initial_memory : 0;
+    return data.length();
+  }
+
   std::vector<Stats::ScopeSharedPtr> scopes_;
   Envoy::Stats::CustomStatNamespacesImpl custom_namespaces_;
   FastMockClusterManager cm_;
@@ -426,6 +455,33 @@ BENCHMARK_CAPTURE(BM_FilteredCountersPrometheus, per_endpoint_stats_disabled, fa
 BENCHMARK_CAPTURE(BM_FilteredCountersPrometheus, per_endpoint_stats_enabled, true)
     ->Unit(benchmark::kMillisecond);
 
+// Compares the memory held while serving all 1M counters as prometheus, either
+// streamed in chunks or buffered in full as before. The peak is reported in the
+// "peak_memory" counter.
+// NOLINTNEXTLINE(readability-identifier-naming)
+static void BM_AllCountersPrometheusMemory(benchmark::State& state, bool streaming) {
+  Envoy::Server::StatsHandlerTest& test_context = testContext(false);
+  Envoy::Server::StatsParams params;
+  Envoy::Buffer::OwnedImpl response;
+  params.parse("?format=prometheus", response);
+
+  uint64_t count;
+  uint64_t peak_memory;
+  for (auto _ : state) { // NOLINT
+    count = streaming ? test_context.handlerStats(params, peak_memory)
+                      : test_context.bufferedPrometheusStats(params, peak_memory);
+    RELEASE_ASSERT(count > 250 * 1000 * 1000, "expected count > 250M");
+  }
+
+  state.counters["peak_memory"] = peak_memory;
+  auto label = absl::StrCat("output per iteration: ", count);
+  state.SetLabel(label);
+}
+BENCHMARK_CAPTURE(BM_AllCountersPrometheusMemory, streaming, true)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_AllCountersPrometheusMemory, buffered, false)
+    ->Unit(benchmark::kMillisecond);
+
 // NOLINTNEXTLINE(readability-identifier-naming)
 static void BM_HistogramsJson(benchmark::State& state, bool per_endpoint_stats) {
   Envoy::Server::StatsHandlerTest& test_context = testContext(per_endpoint_stats);
@@ -4,6 +4,7 @@
 #include "source/common/common/regex.h"
 #include "source/common/stats/custom_stat_namespaces_impl.h"
 #include "source/common/stats/thread_local_store.h"
+#include "source/server/admin/prometheus_stats.h"
 #include "source/server/admin/stats_handler.h"
 #include "source/server/admin/stats_request.h"
 
@@ -1542,6 +1543,47 @@ TEST_F(StatsHandlerPrometheusDefaultTest, HandlerStatsPrometheusUnsupportedBucke
   EXPECT_EQ(expected_response, code_response.second);
 }
 
+// The streamed exposition matches the fully buffered one, whatever the chunk size.
+TEST_F(StatsHandlerPrometheusDefaultTest, StatsHandlerPrometheusChunked) {
+  for (uint32_t i = 0; i < 20; ++i) {
+    Stats::StatNameTagVector tags{{makeStat("cluster"), makeStat(absl::StrCat("c", i))}};
+    store_->rootScope()
+        ->counterFromStatNameWithTags(makeStat("cluster.upstream.rq.total"), tags)
+        .add(i);
+    store_->rootScope()
+        ->gaugeFromStatNameWithTags(makeStat("cluster.upstream.cx.active"), tags,
+                                    Stats::Gauge::ImportMode::Accumulate)
+        .set(i);
+    store_->rootScope()->counterFromString(absl::StrCat("counter", i)).inc();
+  }
+
+  StatsParams params;
+  Buffer::OwnedImpl parse_response;
+  ASSERT_EQ(Http::Code::OK, params.parse("/stats?format=prometheus", parse_response));
+  Buffer::OwnedImpl expected;
+  PrometheusStatsFormatter::statsAsPrometheus(store_->counters(), store_->gauges(),
+                                              store_->histograms(), {}, endpoints_helper_.cm_,
+                                              expected, params, custom_namespaces_);
+
+  for (uint64_t chunk_size : {1, 100, 1000, 1000000}) {
+    Admin::RequestPtr request = StatsHandler::makePrometheusRequest(
+        *store_, custom_namespaces_, endpoints_helper_.cm_, params);
+    dynamic_cast<PrometheusStatsRequest&>(*request).setChunkSize(chunk_size);
+    Http::TestResponseHeaderMapImpl response_headers;
+    EXPECT_EQ(Http::Code::OK, request->start(response_headers));
+    Buffer::OwnedImpl data;
+    uint32_t num_chunks = 1;
+    while (request->nextChunk(data)) {
+      ++num_chunks;
+    }
+    EXPECT_EQ(expected.toString(), data.toString()) << chunk_size;
+    if (chunk_size == 1) {
+      // Each family is rendered in its own chunk.
+      EXPECT_LT(21, num_chunks);
+    }
+  }
+}
+
 class StatsHandlerPrometheusWithTextReadoutsTest
     : public StatsHandlerPrometheusTest,
       public testing::TestWithParam<std::tuple<Network::Address::IpVersion, std::string>> {};
@@ -8,12 +8,14 @@
 #include "source/server/server.h"
 
 #include "test/benchmark/main.h"
+#include "test/common/stats/real_thread_test_base.h"
 #include "test/mocks/stats/mocks.h"
 #include "test/mocks/upstream/cluster_manager.h"
 #include "test/test_common/simulated_time_system.h"
 #include "test/test_common/utility.h"
 
 #include "absl/strings/str_cat.h"
+#include "absl/synchronization/notification.h"
 #include "benchmark/benchmark.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -78,12 +80,13 @@ public:
     }
   }
 
-  void test(::benchmark::State& state) {
+  void test(::benchmark::State& state, bool changed_only = false) {
     for (auto _ : state) {
       UNREFERENCED_PARAMETER(_);
       std::list<Stats::SinkPtr> sinks;
       sinks.emplace_back(new testing::NiceMock<Stats::MockSink>());
-      Server::InstanceUtil::flushMetricsToSinks(sinks, stats_store_, cm_, time_system_);
+      Server::InstanceUtil::flushMetricsToSinks(sinks, stats_store_, cm_, time_system_,
+                                                changed_only);
     }
   }
 
@@ -118,10 +121,80 @@ static void bmFlushToSinksWithPredicatesSet(::benchmark::State& state) {
   speed_test.test(state);
 }
 
+// After the first iteration no stats change, so this measures the floor cost of a flush
+// that only includes changed stats.
+static void bmFlushChangedOnlyToSinks(::benchmark::State& state) {
+  // Skip expensive benchmarks for unit tests.
+  if (benchmark::skipExpensiveBenchmarks() && state.range(0) > 100) {
+    state.SkipWithError("Skipping expensive benchmark");
+    return;
+  }
+
+  StatsSinkFlushSpeedTest speed_test(state.range(0));
+  speed_test.test(state, true);
+}
+
 BENCHMARK(bmFlushToSinks)->Unit(::benchmark::kMillisecond)->RangeMultiplier(10)->Range(10, 1000000);
 BENCHMARK(bmFlushToSinksWithPredicatesSet)
     ->Unit(::benchmark::kMillisecond)
     ->RangeMultiplier(10)
     ->Range(10, 1000000);
+BENCHMARK(bmFlushChangedOnlyToSinks)
+    ->Unit(::benchmark::kMillisecond)
+    ->RangeMultiplier(10)
+    ->Range(10, 1000000);
+
+// Measures the histogram merge that precedes each flush, with every histogram recorded on every
+// worker so that each parent histogram has one thread-local histogram per worker to merge.
+class HistogramMergeSpeedTest : public Stats::ThreadLocalRealThreadsMixin {
+public:
+  HistogramMergeSpeedTest(uint32_t num_workers, uint32_t num_histograms, uint32_t merge_threads)
+      : ThreadLocalRealThreadsMixin(num_workers) {
+    store_->setHistogramMergeThreads(api_->threadFactory(), merge_threads);
+    runOnMainBlocking([this, num_histograms]() {
+      for (uint32_t idx = 0; idx < num_histograms; ++idx) {
+        histograms_.push_back(&scope_.histogramFromStatName(
+            makeStatName(absl::StrCat("histogram.", idx)), Stats::Histogram::Unit::Unspecified));
+      }
+    });
+  }
+
+  void test(::benchmark::State& state) {
+    for (auto _ : state) {
+      UNREFERENCED_PARAMETER(_);
+      state.PauseTiming();
+      runOnAllWorkersBlocking([this]() {
+        for (Stats::Histogram* histogram : histograms_) {
+          histogram->recordValue(histograms_.size());
+        }
+      });
+      state.ResumeTiming();
+
+      absl::Notification merged;
+      runOnMainBlocking(
+          [this, &merged]() { store_->mergeHistograms([&merged]() { merged.Notify(); }); });
+      merged.WaitForNotification();
+    }
+  }
 
+private:
+  std::vector<Stats::Histogram*> histograms_;
+};
+
+// Args: number of workers, number of histograms, number of merge helper threads.
+static void bmHistogramMerge(::benchmark::State& state) {
+  // Skip expensive benchmarks for unit tests.
+  if (benchmark::skipExpensiveBenchmarks() && state.range(1) > 1000) {
+    state.SkipWithError("Skipping expensive benchmark");
+    return;
+  }
+
+  HistogramMergeSpeedTest speed_test(state.range(0), state.range(1), state.range(2));
+  speed_test.test(state);
+}
+
+BENCHMARK(bmHistogramMerge)
+    ->Unit(::benchmark::kMillisecond)
+    ->ArgsProduct({{1, 4, 8}, {1000, 10000, 100000}, {0, 1, 4}})
+    ->UseRealTime();
 } // namespace Envoy
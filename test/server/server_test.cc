@@ -14,6 +14,7 @@
 #include "source/common/network/listen_socket_impl.h"
 #include "source/common/network/socket_option_impl.h"
 #include "source/common/protobuf/protobuf.h"
+#include "source/common/stats/histogram_impl.h"
 #include "source/common/thread_local/thread_local_impl.h"
 #include "source/common/version/version.h"
 #include "source/server/instance_impl.h"
@@ -52,6 +53,7 @@ using testing::InSequence;
 using testing::Invoke;
 using testing::InvokeWithoutArgs;
 using testing::Return;
+using testing::ReturnRef;
 using testing::SaveArg;
 using testing::StrictMock;
 
@@ -163,6 +165,79 @@ TEST(ServerInstanceUtil, flushImportModeUninitializedGauges) {
   InstanceUtil::flushMetricsToSinks(sinks, store, cm, time_system);
 }
 
+TEST(ServerInstanceUtil, flushChangedOnly) {
+  InSequence s;
+
+  NiceMock<Upstream::MockClusterManager> cm;
+  Stats::TestUtil::TestStore store;
+  Event::SimulatedTimeSystem time_system;
+  Stats::Counter& c = store.counter("hello");
+  c.inc();
+  Stats::Gauge& g = store.gauge("world", Stats::Gauge::ImportMode::Accumulate);
+  g.set(5);
+  Stats::TextReadout& t = store.textReadout("text");
+  t.set("is important");
+
+  std::list<Stats::SinkPtr> sinks;
+  Stats::MockSink* sink = new StrictMock<Stats::MockSink>();
+  sinks.emplace_back(sink);
+
+  // Everything was written before the first flush.
+  EXPECT_CALL(*sink, flush(_)).WillOnce(Invoke([](Stats::MetricSnapshot& snapshot) {
+    EXPECT_EQ(snapshot.counters().size(), 1);
+    EXPECT_EQ(snapshot.gauges().size(), 1);
+    EXPECT_EQ(snapshot.textReadouts().size(), 1);
+  }));
+  InstanceUtil::flushMetricsToSinks(sinks, store, cm, time_system, true);
+
+  // Nothing changed.
+  EXPECT_CALL(*sink, flush(_)).WillOnce(Invoke([](Stats::MetricSnapshot& snapshot) {
+    EXPECT_TRUE(snapshot.counters().empty());
+    EXPECT_TRUE(snapshot.gauges().empty());
+    EXPECT_TRUE(snapshot.textReadouts().empty());
+  }));
+  InstanceUtil::flushMetricsToSinks(sinks, store, cm, time_system, true);
+
+  // A decrement counts as a change, even though it does not mark the gauge used.
+  EXPECT_CALL(*sink, flush(_)).WillOnce(Invoke([](Stats::MetricSnapshot& snapshot) {
+    ASSERT_EQ(snapshot.counters().size(), 1);
+    EXPECT_EQ(snapshot.counters()[0].delta_, 2);
+    ASSERT_EQ(snapshot.gauges().size(), 1);
+    EXPECT_EQ(snapshot.gauges()[0].get().value(), 4);
+    EXPECT_TRUE(snapshot.textReadouts().empty());
+  }));
+  c.add(2);
+  g.dec();
+  InstanceUtil::flushMetricsToSinks(sinks, store, cm, time_system, true);
+
+  // Histograms are included only if they recorded values during the interval.
+  NiceMock<Stats::MockStore> mock_store;
+  auto* idle = new NiceMock<Stats::MockParentHistogram>();
+  auto* active = new NiceMock<Stats::MockParentHistogram>();
+  std::vector<Stats::ParentHistogramSharedPtr> parent_histograms = {
+      Stats::ParentHistogramSharedPtr(idle), Stats::ParentHistogramSharedPtr(active)};
+  histogram_t* active_values = hist_alloc();
+  hist_insert_intscale(active_values, 1, 0, 2);
+  Stats::HistogramStatisticsImpl active_stats(active_values);
+  hist_free(active_values);
+  ON_CALL(*active, intervalStatistics()).WillByDefault(ReturnRef(active_stats));
+  ON_CALL(mock_store, forEachSinkedHistogram)
+      .WillByDefault([&](std::function<void(std::size_t)> f_size,
+                         std::function<void(Stats::ParentHistogram&)> f_stat) {
+        if (f_size != nullptr) {
+          f_size(parent_histograms.size());
+        }
+        for (auto& histogram : parent_histograms) {
+          f_stat(*histogram);
+        }
+      });
+  EXPECT_CALL(*sink, flush(_)).WillOnce(Invoke([active](Stats::MetricSnapshot& snapshot) {
+    ASSERT_EQ(snapshot.histograms().size(), 1);
+    EXPECT_EQ(&snapshot.histograms()[0].get(), active);
+  }));
+  InstanceUtil::flushMetricsToSinks(sinks, mock_store, cm, time_system, true);
+}
+
 TEST(ServerInstanceUtil, RaiseFileLimits) {
   Api::MockOsSysCalls os_sys_calls_;
   TestThreadsafeSingletonInjector<Api::OsSysCallsImpl> os_calls{&os_sys_calls_};
@@ -1086,6 +1086,12 @@ public:
     header_map_->addViaMove(std::move(key), std::move(value));
     header_map_->verifyByteSizeInternalForTest();
   }
+  void addCopyDeferred(absl::string_view key, absl::string_view value) override {
+    header_map_->addCopyDeferred(key, value);
+  }
+  bool iterateForEncoding(HeaderMap::ConstKeyValueIterateCb cb) const override {
+    return header_map_->iterateForEncoding(cb);
+  }
   void addReference(const LowerCaseString& key, absl::string_view value) override {
     header_map_->addReference(key, value);
     header_map_->verifyByteSizeInternalForTest();